@@ -0,0 +1,40 @@
+#pragma once
+/*
+Attributes.h
+Array-based attribute access for contiguous GRBVar / GRBConstr buffers.
+
+Features:
+- One solver call per buffer instead of one per element
+- Works for any handle type with array attribute overloads (GRBVar, GRBConstr)
+- Results returned in owning std::vector (no raw new[] arrays leak out)
+
+Examples:
+  std::vector<double> x = attr::get(model, GRB_DoubleAttr_X, X.data(), X.size());
+  attr::set(model, GRB_DoubleAttr_UB, X.data(), ub.data(), X.size());
+*/
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include "gurobi_c++.h"
+
+namespace mini::attr {
+
+    /// Query a double attribute for n handles with one array call
+    template<typename Handle>
+    std::vector<double> get(GRBModel& model, GRB_DoubleAttr attr, const Handle* items, size_t n) {
+        std::vector<double> out(n);
+        if (n == 0) return out;
+        std::unique_ptr<double[]> raw(model.get(attr, items, static_cast<int>(n)));
+        std::copy(raw.get(), raw.get() + n, out.begin());
+        return out;
+    }
+
+    /// Set a double attribute for n handles with one array call
+    template<typename Handle>
+    void set(GRBModel& model, GRB_DoubleAttr attr, const Handle* items, const double* values, size_t n) {
+        if (n == 0) return;
+        model.set(attr, items, values, static_cast<int>(n));
+    }
+
+} // namespace mini::attr
@@ -0,0 +1,301 @@
+#pragma once
+/*
+ConflictGraph.h
+Pairwise conflicts between binary variables, emitted as a greedy clique cover.
+
+Features:
+- addConflict(a, b) records x_a + x_b <= 1 without touching the model
+- Edges kept in two flat handle arrays until the cover is built; duplicate
+  pairs and self-loops are removed there
+- Compressed adjacency (sorted neighbour lists, nodes ranked by decreasing
+  degree) so graphs with millions of edges stay in a few contiguous buffers
+- Greedy cover: every uncovered edge seeds a clique, grown through the
+  common neighbours of its ends (shorter list walked, longer one searched,
+  bounded per seed), so hubs stay near-linear; every registered pair lies
+  in some clique
+- One atMostOne row per clique, all added with one addConstrs call
+  (fewer rows than pairs, and a tighter LP relaxation)
+
+Examples:
+  ConflictGraph conflicts;
+  conflicts.reserve(pairs.size());
+  for (auto [i, j] : pairs) conflicts.addConflict(X(i), X(j));
+  conflicts.addConflict(Y(t, 0), Z(t));            // any binaries, any groups
+
+  ConstraintGroup rows = conflicts.addAtMostOne(model, "conflict");
+  const CliqueCoverStats& st = conflicts.lastStats();   // edges, cliques, largest
+
+  // Cliques only, or queued into an existing batch
+  CliqueCover cover = conflicts.cover(model);
+  conflicts.addTo(batch, model, "conflict");
+*/
+
+#include <span>
+#include <limits>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include "gurobi_c++.h"
+#include "../indexing/Naming.h"
+#include "ConstraintBatch.h"
+#include "ConstraintGroup.h"
+
+namespace mini {
+
+    /// Cliques in CSR form: clique k is vars[starts[k], starts[k+1])
+    struct CliqueCover {
+        std::vector<size_t> starts{ 0 };
+        std::vector<GRBVar> vars;
+
+        size_t size() const { return starts.size() - 1; }
+
+        std::span<const GRBVar> clique(size_t k) const {
+            return std::span<const GRBVar>(vars.data() + starts[k], starts[k + 1] - starts[k]);
+        }
+    };
+
+    /// Size of the last cover built
+    struct CliqueCoverStats {
+        size_t nodes = 0;        ///< Variables with at least one conflict
+        size_t edges = 0;        ///< Distinct conflicting pairs
+        size_t cliques = 0;      ///< Rows emitted
+        size_t largest = 0;      ///< Largest clique
+    };
+
+    class ConflictGraph {
+        std::vector<GRBVar> from;         ///< First variable of each registered pair
+        std::vector<GRBVar> to;           ///< Second variable of each registered pair
+        CliqueCoverStats last;            ///< Statistics of the last cover()
+
+        using Node = uint32_t;
+        static constexpr Node none = std::numeric_limits<Node>::max();
+
+    public:
+        /// Pre-size the edge buffers
+        void reserve(size_t edgeCount) {
+            from.reserve(edgeCount);
+            to.reserve(edgeCount);
+        }
+
+        /// Record that a and b cannot both be 1
+        void addConflict(const GRBVar& a, const GRBVar& b) {
+            from.push_back(a);
+            to.push_back(b);
+        }
+
+        /// Record the pairs (a[k], b[k])
+        void addConflicts(std::span<const GRBVar> a, std::span<const GRBVar> b) {
+            if (a.size() != b.size()) {
+                throw std::invalid_argument("ConflictGraph::addConflicts(): pair arrays differ in length");
+            }
+            from.insert(from.end(), a.begin(), a.end());
+            to.insert(to.end(), b.begin(), b.end());
+        }
+
+        /// Registered pairs (duplicates included)
+        size_t pairs() const { return from.size(); }
+
+        bool empty() const { return from.empty(); }
+
+        void clear() {
+            from.clear();
+            to.clear();
+        }
+
+        const CliqueCoverStats& lastStats() const { return last; }
+
+        /// Greedy clique cover of the registered conflicts (one update() to
+        /// resolve variable indices; the registered pairs are kept)
+        CliqueCover cover(GRBModel& model) {
+            CliqueCover out;
+            last = {};
+            if (from.empty()) return out;
+            model.update();
+
+            // Dense node ids for the variables that appear in a pair
+            int maxIndex = -1;
+            for (size_t e = 0; e < from.size(); ++e) maxIndex = std::max({ maxIndex, from[e].index(), to[e].index() });
+            std::vector<Node> idOf(static_cast<size_t>(maxIndex) + 1, none);
+            std::vector<GRBVar> handle;
+            auto nodeOf = [&](const GRBVar& v) {
+                const int i = v.index();
+                if (i < 0) throw std::invalid_argument("ConflictGraph: variable is not part of the model");
+                Node& id = idOf[static_cast<size_t>(i)];
+                if (id == none) {
+                    id = static_cast<Node>(handle.size());
+                    handle.push_back(v);
+                }
+                return id;
+            };
+            std::vector<std::pair<Node, Node>> edges;
+            edges.reserve(from.size());
+            for (size_t e = 0; e < from.size(); ++e) {
+                const Node a = nodeOf(from[e]), b = nodeOf(to[e]);
+                if (a != b) edges.emplace_back(a, b);
+            }
+            const size_t n = handle.size();
+
+            // Adjacency in node-id space, deduplicated
+            std::vector<size_t> start;
+            std::vector<Node> adj;
+            buildAdjacency(n, edges, start, adj);
+            std::vector<std::pair<Node, Node>>().swap(edges);
+
+            // Rank nodes by decreasing degree and rebuild the lists in rank
+            // space, so each sorted neighbour list lists high-degree nodes first
+            std::vector<Node> order(n), rank(n);
+            for (size_t v = 0; v < n; ++v) order[v] = static_cast<Node>(v);
+            std::stable_sort(order.begin(), order.end(), [&](Node a, Node b) {
+                return start[a + 1] - start[a] > start[b + 1] - start[b];
+            });
+            for (size_t r = 0; r < n; ++r) rank[order[r]] = static_cast<Node>(r);
+            {
+                std::vector<size_t> rs(n + 1, 0);
+                std::vector<Node> ra(adj.size());
+                for (size_t r = 0; r < n; ++r) {
+                    const Node v = order[r];
+                    rs[r + 1] = rs[r] + (start[v + 1] - start[v]);
+                    std::transform(adj.begin() + start[v], adj.begin() + start[v + 1], ra.begin() + rs[r],
+                        [&](Node w) { return rank[w]; });
+                    std::sort(ra.begin() + rs[r], ra.begin() + rs[r + 1]);
+                }
+                start.swap(rs);
+                adj.swap(ra);
+            }
+
+            greedyCover(n, start, adj, [&](std::span<const Node> clique) {
+                for (Node r : clique) out.vars.push_back(handle[order[r]]);
+                out.starts.push_back(out.vars.size());
+                last.largest = std::max(last.largest, clique.size());
+            });
+
+            last.nodes = n;
+            last.edges = adj.size() / 2;
+            last.cliques = out.size();
+            return out;
+        }
+
+        /// Queue one atMostOne row per clique (names base[k] under DEBUG_NAMES)
+        void addTo(ConstraintBatch& batch, GRBModel& model, const std::string& baseName = "") {
+            const CliqueCover cliques = cover(model);
+            FamilyScope family(batch, baseName);
+            std::vector<double> ones(last.largest, 1.0);
+            batch.reserve(batch.rows() + cliques.size(), batch.nonzeros() + cliques.vars.size());
+            for (size_t k = 0; k < cliques.size(); ++k) {
+                const auto members = cliques.clique(k);
+                batch.add(members, std::span<const double>(ones.data(), members.size()), GRB_LESS_EQUAL, 1.0,
+                    baseName.empty() ? std::string() : naming::nameND(baseName, static_cast<int>(k)));
+            }
+        }
+
+        /// Add one atMostOne row per clique with a single addConstrs call
+        ConstraintGroup addAtMostOne(GRBModel& model, const std::string& baseName = "") {
+            ConstraintBatch batch;
+            addTo(batch, model, baseName);
+            std::vector<GRBConstr> rows = batch.flush(model);
+            const size_t count = rows.size();
+            return ConstraintGroup(std::move(rows), { count });
+        }
+
+    private:
+        /// Symmetric CSR adjacency of an edge list, each list sorted with
+        /// duplicates removed
+        static void buildAdjacency(size_t n, const std::vector<std::pair<Node, Node>>& edges,
+            std::vector<size_t>& start, std::vector<Node>& adj) {
+            std::vector<size_t> fill(n + 1, 0);
+            for (const auto& [a, b] : edges) {
+                ++fill[a + 1];
+                ++fill[b + 1];
+            }
+            for (size_t v = 0; v < n; ++v) fill[v + 1] += fill[v];
+            std::vector<Node> raw(fill[n]);
+            std::vector<size_t> cursor(fill.begin(), fill.end() - 1);
+            for (const auto& [a, b] : edges) {
+                raw[cursor[a]++] = b;
+                raw[cursor[b]++] = a;
+            }
+
+            start.assign(n + 1, 0);
+            adj.clear();
+            adj.reserve(raw.size());
+            for (size_t v = 0; v < n; ++v) {
+                auto first = raw.begin() + fill[v], end = raw.begin() + fill[v + 1];
+                std::sort(first, end);
+                adj.insert(adj.end(), first, std::unique(first, end));
+                start[v + 1] = adj.size();
+            }
+        }
+
+        /// Common neighbours tried per clique; bounds the work per uncovered
+        /// edge so hub nodes do not make the cover quadratic
+        static constexpr size_t candidateCap = 256;
+
+        /// Visit nodes in rank order; while a node v has an uncovered edge
+        /// (v, seed), grow a clique from that pair. Candidates are the common
+        /// neighbours of v and seed, found by walking the shorter of the two
+        /// lists and binary-searching the longer one (at most candidateCap).
+        /// Among candidates adjacent to the whole clique, those whose edge to
+        /// v is still uncovered are taken first.
+        template<typename Emit>
+        static void greedyCover(size_t n, const std::vector<size_t>& start, const std::vector<Node>& adj, Emit&& emit) {
+            std::vector<char> covered(adj.size(), 0);
+            std::vector<size_t> open(n), cursor(start.begin(), start.end() - 1);
+            for (size_t v = 0; v < n; ++v) open[v] = start[v + 1] - start[v];
+
+            auto degree = [&](Node u) { return start[u + 1] - start[u]; };
+            auto slot = [&](Node u, Node w) {
+                return static_cast<size_t>(std::lower_bound(adj.begin() + start[u], adj.begin() + start[u + 1], w) - adj.begin());
+            };
+            auto adjacent = [&](Node u, Node w) {
+                return std::binary_search(adj.begin() + start[u], adj.begin() + start[u + 1], w);
+            };
+            auto markCovered = [&](Node u, Node w) {
+                const size_t p = slot(u, w);
+                if (covered[p]) return;
+                covered[p] = 1;
+                covered[slot(w, u)] = 1;
+                --open[u];
+                --open[w];
+            };
+
+            std::vector<Node> clique, cand;
+            for (size_t s = 0; s < n; ++s) {
+                const Node v = static_cast<Node>(s);
+                while (open[v] > 0) {
+                    while (covered[cursor[v]]) ++cursor[v];
+                    const Node seed = adj[cursor[v]];
+
+                    clique.assign({ v, seed });
+                    cand.clear();
+                    const Node shorter = degree(v) <= degree(seed) ? v : seed;
+                    const Node longer = shorter == v ? seed : v;
+                    for (size_t p = start[shorter]; p < start[shorter + 1] && cand.size() < candidateCap; ++p) {
+                        if (adjacent(longer, adj[p])) cand.push_back(adj[p]);
+                    }
+
+                    while (!cand.empty()) {
+                        size_t pick = 0;
+                        for (size_t k = 0; k < cand.size(); ++k) {
+                            if (!covered[slot(v, cand[k])]) {
+                                pick = k;
+                                break;
+                            }
+                        }
+                        const Node w = cand[pick];
+                        clique.push_back(w);
+                        std::erase_if(cand, [&](Node c) { return c == w || !adjacent(w, c); });
+                    }
+
+                    for (size_t i = 0; i < clique.size(); ++i) {
+                        for (size_t j = i + 1; j < clique.size(); ++j) markCovered(clique[i], clique[j]);
+                    }
+                    emit(std::span<const Node>(clique));
+                }
+            }
+        }
+    };
+
+} // namespace mini
@@ -0,0 +1,580 @@
+#pragma once
+/*
+ConstraintBatch.h
+Row buffer that adds a whole family of linear constraints in one call.
+
+Features:
+- Rows stored in CSR form (row starts, columns, values, senses, rhs)
+- flush() adds every buffered row with a single array-based addConstrs
+- flushAll() merges several buffers (e.g. one per thread) in order,
+  still with a single call
+- Row names only stored when DEBUG_NAMES is on
+- Row / le / ge / eq build rows that the variadic addConstr batches
+- Optional singleton mode: one-variable rows become LB/UB updates
+  (one bulk get and one bulk set per bound), counted in BuildStats
+- Optional redundancy pass: rows are canonicalized (terms merged and
+  sorted by column, scaled so the first coefficient is +1) and hashed on
+  coefficients rounded to a ~1e-9 relative grid; candidates compare equal
+  within 1e-12 relative, and coefficients that sit next to a rounding
+  boundary are also looked up on the other side of it. Duplicates and
+  parallel rows dominated by a tighter one are dropped
+- Rows carry a family tag (set by the variadic builders from their base
+  name), so BuildStats also reports rows added / dropped per family
+
+Examples:
+  ConstraintBatch batch;
+  forEach([&](int i, int j) {
+      batch.add(x(i,j) - y(i), GRB_LESS_EQUAL, 0.0, naming::nameND("link", i, j));
+  }, I, J);
+  std::vector<GRBConstr> rows = batch.flush(model);   // one API call
+
+  // Variadic builder: returning a Row selects the batched path
+  addConstr(model, [&](int i, int j) { return le(x(i,j), cap(i)); }, "cap", I, J);
+
+  // x(i,j) <= cap(i) tightens UB of x(i,j) instead of adding a row
+  ConstraintBatch rows({ .singletonsToBounds = true });
+  addConstr(rows, [&](int i, int j) { return le(x(i,j), cap(i)); }, "cap", I, J);
+  rows.flush(model);
+  size_t converted = rows.stats().boundsTightened;
+
+  // 2x + 4y <= 8 and x + 2y <= 3 are parallel: only the second is added
+  ConstraintBatch cover({ .dropRedundant = true });
+  addConstr(cover, [&](int k) { return le(coverExpr(k), coverRhs(k)); }, "cover", K);
+  cover.flush(model);
+  size_t dropped = cover.stats().duplicatesDropped + cover.stats().dominatedDropped;
+
+  // Per-family report from one shared batch
+  ConstraintBatch all({ .dropRedundant = true });
+  addConstr(all, capRow, "cap", I, J);
+  addConstr(all, coverRow, "cover", K);
+  all.flush(model);
+  size_t coverDuplicates = all.stats().families.at("cover").duplicatesDropped;
+*/
+
+#include <bit>
+#include <map>
+#include <span>
+#include <cmath>
+#include <tuple>
+#include <cstdint>
+#include <memory>
+#include <iterator>
+#include <utility>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <unordered_map>
+#include "gurobi_c++.h"
+#include "../indexing/Naming.h"
+#include "Attributes.h"
+
+namespace mini {
+
+    /// Linear row: lhs (sense) rhs, with every variable term kept in lhs
+    struct Row {
+        GRBLinExpr lhs;
+        char sense = GRB_LESS_EQUAL;
+        double rhs = 0.0;
+    };
+
+    namespace constraint {
+
+        /// Row lhs <= rhs
+        inline Row le(const GRBLinExpr& lhs, double rhs) { return Row{ lhs, GRB_LESS_EQUAL, rhs }; }
+        inline Row le(const GRBLinExpr& lhs, const GRBLinExpr& rhs) { return Row{ lhs - rhs, GRB_LESS_EQUAL, 0.0 }; }
+
+        /// Row lhs >= rhs
+        inline Row ge(const GRBLinExpr& lhs, double rhs) { return Row{ lhs, GRB_GREATER_EQUAL, rhs }; }
+        inline Row ge(const GRBLinExpr& lhs, const GRBLinExpr& rhs) { return Row{ lhs - rhs, GRB_GREATER_EQUAL, 0.0 }; }
+
+        /// Row lhs == rhs
+        inline Row eq(const GRBLinExpr& lhs, double rhs) { return Row{ lhs, GRB_EQUAL, rhs }; }
+        inline Row eq(const GRBLinExpr& lhs, const GRBLinExpr& rhs) { return Row{ lhs - rhs, GRB_EQUAL, 0.0 }; }
+
+    } // namespace constraint
+
+    /// Reductions applied by ConstraintBatch::flush()
+    struct BatchOptions {
+        bool singletonsToBounds = false;  ///< Turn one-variable rows into bound updates
+        bool dropRedundant = false;       ///< Drop duplicate and dominated parallel rows
+    };
+
+    /// Flush counters of one constraint family
+    struct FamilyStats {
+        size_t rowsAdded = 0;             ///< Rows submitted to the model
+        size_t boundsTightened = 0;       ///< Singleton rows turned into LB/UB updates
+        size_t duplicatesDropped = 0;     ///< Rows identical to another after scaling
+        size_t dominatedDropped = 0;      ///< Rows implied by a tighter parallel row
+
+        FamilyStats& operator+=(const FamilyStats& o) {
+            rowsAdded += o.rowsAdded;
+            boundsTightened += o.boundsTightened;
+            duplicatesDropped += o.duplicatesDropped;
+            dominatedDropped += o.dominatedDropped;
+            return *this;
+        }
+    };
+
+    /// What flush() did with the buffered rows (accumulated over flushes):
+    /// totals, plus the same counters for every named family
+    struct BuildStats : FamilyStats {
+        std::map<std::string, FamilyStats> families;   ///< Keyed by family tag
+
+        BuildStats& operator+=(const BuildStats& o) {
+            FamilyStats::operator+=(o);
+            for (const auto& [name, f] : o.families) families[name] += f;
+            return *this;
+        }
+    };
+
+    class ConstraintBatch {
+        BatchOptions opts;                    ///< Reductions applied at flush
+        BuildStats totals;                    ///< Accumulated flush statistics
+        std::vector<size_t> starts{ 0 };      ///< Row r occupies [starts[r], starts[r+1])
+        std::vector<GRBVar> cols;             ///< Column of each nonzero
+        std::vector<double> vals;             ///< Coefficient of each nonzero
+        std::vector<char> senses;             ///< Sense of each row
+        std::vector<double> rhs;              ///< Right-hand side of each row
+        std::vector<std::string> names;       ///< Row names (empty unless a row was named)
+        std::vector<uint32_t> tags;           ///< Family of each row (index into familyNames)
+        std::vector<std::string> familyNames{ std::string() };  ///< Tag 0 is the unnamed family
+        uint32_t current = 0;                 ///< Tag given to new rows
+
+    public:
+        ConstraintBatch() = default;
+        explicit ConstraintBatch(BatchOptions options) : opts(options) {}
+
+        const BatchOptions& options() const { return opts; }
+        void setOptions(BatchOptions options) { opts = options; }
+
+        /// Statistics accumulated over all flushes of this batch
+        const BuildStats& stats() const { return totals; }
+
+        /// Tag the rows added from now on as family `name` ("" = untagged);
+        /// flush statistics are also reported per tagged family
+        void setFamily(const std::string& name) {
+            const auto it = std::find(familyNames.begin(), familyNames.end(), name);
+            current = static_cast<uint32_t>(it - familyNames.begin());
+            if (it == familyNames.end()) familyNames.push_back(name);
+        }
+
+        /// Family tag given to new rows
+        const std::string& family() const { return familyNames[current]; }
+
+        /// Number of buffered rows
+        size_t rows() const { return senses.size(); }
+
+        /// Number of buffered nonzeros
+        size_t nonzeros() const { return cols.size(); }
+
+        bool empty() const { return senses.empty(); }
+
+        /// Pre-size the buffers
+        void reserve(size_t rowCount, size_t nonzeroCount = 0) {
+            starts.reserve(rowCount + 1);
+            senses.reserve(rowCount);
+            rhs.reserve(rowCount);
+            cols.reserve(nonzeroCount);
+            vals.reserve(nonzeroCount);
+        }
+
+        /// Add a row from parallel variable / coefficient arrays
+        void add(std::span<const GRBVar> vars, std::span<const double> coeffs, char sense, double rowRhs,
+            const std::string& name = "") {
+            if (vars.size() != coeffs.size()) {
+                throw std::invalid_argument("ConstraintBatch::add(): variable and coefficient counts differ");
+            }
+            cols.insert(cols.end(), vars.begin(), vars.end());
+            vals.insert(vals.end(), coeffs.begin(), coeffs.end());
+            closeRow(sense, rowRhs, name);
+        }
+
+        /// Add a row lhs (sense) rhs; the constant of lhs moves to the right-hand side
+        void add(const GRBLinExpr& lhs, char sense, double rowRhs, const std::string& name = "") {
+            const unsigned n = lhs.size();
+            for (unsigned k = 0; k < n; ++k) {
+                cols.push_back(lhs.getVar(k));
+                vals.push_back(lhs.getCoeff(k));
+            }
+            closeRow(sense, rowRhs - lhs.getConstant(), name);
+        }
+
+        void add(const Row& row, const std::string& name = "") { add(row.lhs, row.sense, row.rhs, name); }
+
+        /// Visit buffered rows as fn(vars, coeffs, sense, rhs) without building
+        /// expressions (e.g. to submit them from a callback)
+        template<typename F>
+        void forEachRow(F&& fn) const {
+            for (size_t r = 0; r < rows(); ++r) {
+                const size_t first = starts[r], len = starts[r + 1] - first;
+                fn(std::span<const GRBVar>(cols.data() + first, len),
+                    std::span<const double>(vals.data() + first, len), senses[r], rhs[r]);
+            }
+        }
+
+        /// Drop all buffered rows
+        void clear() {
+            starts.assign(1, 0);
+            cols.clear();
+            vals.clear();
+            senses.clear();
+            rhs.clear();
+            names.clear();
+            tags.clear();
+        }
+
+        /// Add every buffered row with one addConstrs call and clear the buffer.
+        /// With reductions enabled, only the rows actually added get a handle.
+        std::vector<GRBConstr> flush(GRBModel& model) {
+            return flushAll(model, std::span<ConstraintBatch>(this, 1), opts, &totals);
+        }
+
+        /// Add the rows of several batches, in order, with one addConstrs call
+        /// and clear them (used to merge per-thread buffers without copying)
+        static std::vector<GRBConstr> flushAll(GRBModel& model, std::span<ConstraintBatch> parts,
+            const BatchOptions& options = {}, BuildStats* stats = nullptr) {
+            BuildStats run;
+            if (options.singletonsToBounds) tightenSingletons(model, parts, run);
+            if (options.dropRedundant) dropRedundantRows(model, parts, run);
+            for (const auto& p : parts) {
+                for (size_t r = 0; r < p.rows(); ++r) {
+                    if (FamilyStats* f = familyStats(run, p, r)) ++f->rowsAdded;
+                }
+            }
+
+            size_t n = 0;
+            bool named = false;
+            for (const auto& p : parts) {
+                n += p.rows();
+                named = named || !p.names.empty();
+            }
+            std::vector<GRBConstr> out;
+            if (n > 0) {
+                std::vector<GRBLinExpr> exprs(n);
+                std::vector<char> senses;
+                std::vector<double> rhs;
+                std::vector<std::string> names;
+                senses.reserve(n);
+                rhs.reserve(n);
+                if (named) names.reserve(n);
+
+                size_t r = 0;
+                for (auto& p : parts) {
+                    for (size_t k = 0; k < p.rows(); ++k, ++r) {
+                        const size_t first = p.starts[k], len = p.starts[k + 1] - first;
+                        if (len > 0) exprs[r].addTerms(p.vals.data() + first, p.cols.data() + first, static_cast<int>(len));
+                    }
+                    senses.insert(senses.end(), p.senses.begin(), p.senses.end());
+                    rhs.insert(rhs.end(), p.rhs.begin(), p.rhs.end());
+                    if (named) {
+                        p.names.resize(p.rows());
+                        std::move(p.names.begin(), p.names.end(), std::back_inserter(names));
+                    }
+                }
+
+                std::unique_ptr<GRBConstr[]> added(model.addConstrs(exprs.data(), senses.data(), rhs.data(),
+                    named ? names.data() : nullptr, static_cast<int>(n)));
+                out.assign(added.get(), added.get() + n);
+            }
+            for (auto& p : parts) p.clear();
+
+            run.rowsAdded = n;
+            if (stats) *stats += run;
+            return out;
+        }
+
+    private:
+        /// Keep only the rows selected by keep[r] (names follow their rows)
+        void compact(const std::vector<char>& keep) {
+            const bool named = !names.empty();
+            if (named) names.resize(rows());
+            size_t w = 0, nz = 0;
+            for (size_t r = 0; r < rows(); ++r) {
+                if (!keep[r]) continue;
+                for (size_t k = starts[r]; k < starts[r + 1]; ++k, ++nz) {
+                    cols[nz] = cols[k];
+                    vals[nz] = vals[k];
+                }
+                senses[w] = senses[r];
+                rhs[w] = rhs[r];
+                tags[w] = tags[r];
+                if (named) names[w] = std::move(names[r]);
+                starts[++w] = nz;
+            }
+            starts.resize(w + 1);
+            cols.resize(nz);
+            vals.resize(nz);
+            senses.resize(w);
+            rhs.resize(w);
+            tags.resize(w);
+            if (named) names.resize(w);
+        }
+
+        /// Turn rows a*x (sense) b into bounds on x: one update(), one LB and
+        /// one UB array query, one LB and one UB array set for all of them
+        static void tightenSingletons(GRBModel& model, std::span<ConstraintBatch> parts, BuildStats& run) {
+            size_t singletons = 0;
+            for (const auto& p : parts) {
+                for (size_t r = 0; r < p.rows(); ++r) {
+                    if (p.starts[r + 1] - p.starts[r] == 1 && p.vals[p.starts[r]] != 0.0) ++singletons;
+                }
+            }
+            if (singletons == 0) return;
+
+            // Distinct target columns (a variable may appear in several singleton rows)
+            model.update();
+            std::vector<GRBVar> targets;
+            std::unordered_map<int, size_t> slot;
+            for (const auto& p : parts) {
+                for (size_t r = 0; r < p.rows(); ++r) {
+                    const size_t k = p.starts[r];
+                    if (p.starts[r + 1] - k != 1 || p.vals[k] == 0.0) continue;
+                    if (slot.try_emplace(p.cols[k].index(), targets.size()).second) targets.push_back(p.cols[k]);
+                }
+            }
+            std::vector<double> lb = attr::get(model, GRB_DoubleAttr_LB, targets.data(), targets.size());
+            std::vector<double> ub = attr::get(model, GRB_DoubleAttr_UB, targets.data(), targets.size());
+
+            for (auto& p : parts) {
+                std::vector<char> keep(p.rows(), 1);
+                for (size_t r = 0; r < p.rows(); ++r) {
+                    const size_t k = p.starts[r];
+                    if (p.starts[r + 1] - k != 1 || p.vals[k] == 0.0) continue;
+                    const size_t t = slot[p.cols[k].index()];
+                    const double a = p.vals[k], bound = p.rhs[r] / a;
+                    const char sense = a > 0 ? p.senses[r] : flipped(p.senses[r]);
+                    if (sense != GRB_GREATER_EQUAL) ub[t] = std::min(ub[t], bound);
+                    if (sense != GRB_LESS_EQUAL) lb[t] = std::max(lb[t], bound);
+                    keep[r] = 0;
+                    if (FamilyStats* f = familyStats(run, p, r)) ++f->boundsTightened;
+                }
+                p.compact(keep);
+            }
+
+            attr::set(model, GRB_DoubleAttr_LB, targets.data(), lb.data(), targets.size());
+            attr::set(model, GRB_DoubleAttr_UB, targets.data(), ub.data(), targets.size());
+            run.boundsTightened += singletons;
+        }
+
+        /// Counters of the family row r of p belongs to (nullptr if untagged)
+        static FamilyStats* familyStats(BuildStats& run, const ConstraintBatch& p, size_t r) {
+            const uint32_t tag = r < p.tags.size() ? p.tags[r] : 0;
+            return tag == 0 ? nullptr : &run.families[p.familyNames[tag]];
+        }
+
+        /// Canonical form of the rows of several batches: terms merged and sorted
+        /// by column index, divided by the first coefficient (sense flipped when
+        /// it is negative). Rows hash on their coefficients rounded to the grid
+        /// (keys) and compare on the exact values within tolerance.
+        struct CanonicalRows {
+            std::vector<size_t> starts{ 0 };
+            std::vector<int> cols;
+            std::vector<double> vals;
+            std::vector<double> keys;
+            std::vector<char> senses;
+            std::vector<double> rhs;
+
+            bool equal(size_t a, size_t b) const {
+                const size_t la = starts[a + 1] - starts[a], lb = starts[b + 1] - starts[b];
+                return senses[a] == senses[b] && la == lb
+                    && std::equal(cols.begin() + starts[a], cols.begin() + starts[a + 1], cols.begin() + starts[b])
+                    && std::equal(vals.begin() + starts[a], vals.begin() + starts[a + 1], vals.begin() + starts[b],
+                        [](double x, double y) { return std::abs(x - y) <= tolerance * std::max(std::abs(x), std::abs(y)); });
+            }
+
+            /// Hash of row r with its grid keys replaced by rowKeys
+            uint64_t hash(size_t r, const double* rowKeys) const {
+                uint64_t h = static_cast<unsigned char>(senses[r]);
+                auto mix = [&](uint64_t v) { h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2); };
+                for (size_t k = starts[r]; k < starts[r + 1]; ++k) {
+                    mix(static_cast<uint64_t>(cols[k]));
+                    mix(std::bit_cast<uint64_t>(rowKeys[k - starts[r]]));
+                }
+                return h;
+            }
+
+            uint64_t hash(size_t r) const { return hash(r, keys.data() + starts[r]); }
+        };
+
+        /// Drop rows whose canonical lhs and sense match an earlier row: equal
+        /// rhs is a duplicate; for <= / >= the looser rhs is dominated. Equality
+        /// rows with different rhs are kept (the model is infeasible either way).
+        static void dropRedundantRows(GRBModel& model, std::span<ConstraintBatch> parts, BuildStats& run) {
+            size_t total = 0, nonzeros = 0;
+            for (const auto& p : parts) {
+                total += p.rows();
+                nonzeros += p.nonzeros();
+            }
+            if (total < 2) return;
+            model.update();  // column indices
+
+            CanonicalRows canon;
+            std::vector<FamilyStats*> family;
+            family.reserve(total);
+            canon.starts.reserve(total + 1);
+            canon.cols.reserve(nonzeros);
+            canon.vals.reserve(nonzeros);
+            canon.keys.reserve(nonzeros);
+            canon.senses.reserve(total);
+            canon.rhs.reserve(total);
+            std::vector<std::pair<int, double>> terms;
+            for (const auto& p : parts) {
+                for (size_t r = 0; r < p.rows(); ++r) {
+                    terms.clear();
+                    for (size_t k = p.starts[r]; k < p.starts[r + 1]; ++k) terms.emplace_back(p.cols[k].index(), p.vals[k]);
+                    std::sort(terms.begin(), terms.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+                    // Merge repeated columns and drop zeros
+                    size_t w = 0;
+                    for (size_t k = 0; k < terms.size(); ++k) {
+                        if (w > 0 && terms[w - 1].first == terms[k].first) terms[w - 1].second += terms[k].second;
+                        else terms[w++] = terms[k];
+                        if (terms[w - 1].second == 0.0) --w;
+                    }
+                    terms.resize(w);
+
+                    const double lead = terms.empty() ? 1.0 : terms.front().second;
+                    for (const auto& [c, v] : terms) {
+                        canon.cols.push_back(c);
+                        canon.vals.push_back(v / lead);
+                        canon.keys.push_back(quantize(v / lead));
+                    }
+                    canon.starts.push_back(canon.cols.size());
+                    canon.senses.push_back(lead < 0 ? flipped(p.senses[r]) : p.senses[r]);
+                    canon.rhs.push_back(p.rhs[r] / lead);
+                    family.push_back(familyStats(run, p, r));
+                }
+            }
+
+            // Survivor per canonical lhs + sense, filed under its own grid keys;
+            // later rows either lose or replace it
+            std::vector<char> keep(total, 1);
+            std::unordered_multimap<uint64_t, size_t> survivors;
+            survivors.reserve(total);
+            std::vector<double> probe;
+            std::vector<std::pair<size_t, double>> alternates;
+            for (size_t r = 0; r < total; ++r) {
+                if (canon.starts[r + 1] == canon.starts[r]) continue;  // empty rows are left to the solver
+                const uint64_t h = canon.hash(r);
+                auto [it, end] = survivors.equal_range(h);
+                while (it != end && !canon.equal(it->second, r)) ++it;
+
+                if (it == end) {
+                    // A match within tolerance may sit across a grid boundary:
+                    // retry with boundary coefficients rounded the other way
+                    alternates.clear();
+                    for (size_t k = canon.starts[r]; k < canon.starts[r + 1] && alternates.size() < maxAlternates; ++k) {
+                        const double other = otherSide(canon.vals[k]);
+                        if (other != canon.keys[k]) alternates.emplace_back(k - canon.starts[r], other);
+                    }
+                    for (size_t mask = 1; mask < (size_t{ 1 } << alternates.size()) && it == end; ++mask) {
+                        probe.assign(canon.keys.begin() + canon.starts[r], canon.keys.begin() + canon.starts[r + 1]);
+                        for (size_t a = 0; a < alternates.size(); ++a) {
+                            if (mask >> a & 1) probe[alternates[a].first] = alternates[a].second;
+                        }
+                        std::tie(it, end) = survivors.equal_range(canon.hash(r, probe.data()));
+                        while (it != end && !canon.equal(it->second, r)) ++it;
+                    }
+                }
+                if (it == end) {
+                    survivors.emplace(h, r);
+                    continue;
+                }
+
+                const size_t s = it->second;
+                const double mine = canon.rhs[r], theirs = canon.rhs[s];
+                if (std::abs(mine - theirs) <= tolerance * std::max({ 1.0, std::abs(mine), std::abs(theirs) })) {
+                    keep[r] = 0;
+                    ++run.duplicatesDropped;
+                    if (family[r]) ++family[r]->duplicatesDropped;
+                }
+                else if (canon.senses[r] == GRB_EQUAL) {
+                    continue;
+                }
+                else if ((canon.senses[r] == GRB_LESS_EQUAL) == (mine < theirs)) {
+                    keep[s] = 0;  // this row is tighter
+                    it->second = r;
+                    ++run.dominatedDropped;
+                    if (family[s]) ++family[s]->dominatedDropped;
+                }
+                else {
+                    keep[r] = 0;
+                    ++run.dominatedDropped;
+                    if (family[r]) ++family[r]->dominatedDropped;
+                }
+            }
+
+            size_t g = 0;
+            for (auto& p : parts) {
+                std::vector<char> local(keep.begin() + g, keep.begin() + g + p.rows());
+                g += p.rows();
+                p.compact(local);
+            }
+        }
+
+        /// Relative tolerance under which two canonical coefficients or
+        /// right-hand sides are equal
+        static constexpr double tolerance = 1e-12;
+
+        /// Bits of the relative hashing grid (2^-30, ~1e-9): much coarser than
+        /// the tolerance, so few coefficients lie within tolerance of a boundary
+        static constexpr int gridBits = 30;
+
+        /// Boundary coefficients retried per row (2^maxAlternates lookups at most)
+        static constexpr size_t maxAlternates = 4;
+
+        /// Round to the relative grid: quotients that differ only in the last
+        /// bits (0.01 / 0.3 vs 0.1 / 3) usually map to the same key
+        static double quantize(double v) {
+            int exponent = 0;
+            const double mantissa = std::frexp(v, &exponent);
+            return std::ldexp(std::round(std::ldexp(mantissa, gridBits)), exponent - gridBits);
+        }
+
+        /// Key of v rounded the other way if v lies within tolerance of a
+        /// rounding boundary, else quantize(v)
+        static double otherSide(double v) {
+            int exponent = 0;
+            const double scaled = std::ldexp(std::frexp(v, &exponent), gridBits);
+            const double below = std::floor(scaled), frac = scaled - below;
+            if (std::abs(frac - 0.5) > 2.0 * tolerance * std::ldexp(1.0, gridBits)) return quantize(v);
+            return std::ldexp(frac < 0.5 ? below + 1.0 : below, exponent - gridBits);
+        }
+
+        /// Sense of the row after multiplying both sides by -1
+        static char flipped(char sense) {
+            return sense == GRB_LESS_EQUAL ? GRB_GREATER_EQUAL : sense == GRB_GREATER_EQUAL ? GRB_LESS_EQUAL : GRB_EQUAL;
+        }
+
+        void closeRow(char sense, double rowRhs, const std::string& name) {
+            starts.push_back(cols.size());
+            senses.push_back(sense);
+            rhs.push_back(rowRhs);
+            tags.push_back(current);
+            if constexpr (DEBUG_NAMES) {
+                if (!name.empty()) {
+                    names.resize(senses.size() - 1);
+                    names.push_back(name);
+                }
+            }
+        }
+    };
+
+    /// Tag the rows added to a batch during a scope as one family (restores
+    /// the previous tag on exit; an empty name keeps the current tag)
+    class FamilyScope {
+        ConstraintBatch& batch;
+        std::string outer;
+
+    public:
+        FamilyScope(ConstraintBatch& target, const std::string& name) : batch(target), outer(target.family()) {
+            if (!name.empty()) batch.setFamily(name);
+        }
+        ~FamilyScope() { batch.setFamily(outer); }
+
+        FamilyScope(const FamilyScope&) = delete;
+        FamilyScope& operator=(const FamilyScope&) = delete;
+    };
+
+} // namespace mini
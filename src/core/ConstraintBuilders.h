@@ -5,8 +5,10 @@ High-level constraint building patterns using recursive variadic templates.
 
 Features:
 - Common constraint patterns (atMostOne, exactlyOne, big-M)
+- Partitioned atMostOne / exactlyOne over chosen dimensions of a group
 - Variadic iteration for constraint building
 - Logical implications and indicator constraints
+- Native SOS1/SOS2 sets and piecewise-linear general constraints
 - Clean, reusable building blocks
 
 Examples:
@@ -18,15 +20,66 @@ Examples:
       addLe(model, x(i,j,k), capacity(k), "capacity_constraint");
   }, I, J, K);
 
+  // Whole family in one addConstrs call; handles kept for duals
+  ConstraintGroup cap = addConstr(model, [&](int i, int j) { return le(x(i,j), capacity(i)); }, "cap", I, J);
+  ValueArray pi = cap.pi(model);
+
+  // Queue rows; one-variable rows become bound updates at flush
+  ConstraintBatch rows({ .singletonsToBounds = true });
+  addLe(rows, x(i,j), capacity(i), "cap");
+  rows.flush(model);
+
+  // Same family generated on all cores, flushed once in deterministic order
+  addConstr(par, model, [&](int i, int j) { return le(x(i,j), capacity(i)); }, "cap", I, J);
+
+  // Big-M with M derived from variable bounds (scalar form for one-off rows,
+  // conBigM(...) for families)
+  double M = conBigM_Le(model, flow(i), cap(i), open(i));
+  BigMFamily fam = conBigM(model, [&](int i) { return onlyIf(open(i), le(flow(i), cap(i))); }, "link", I);
+  double worst = fam.maxM();
+
+  // Band lo <= expr <= hi as one row, ends movable in bulk later
+  RangeFamily band = addRange(model, [&](int t) { return between(lo[t], stock(t), hi[t]); }, "band", T);
+  band.setBounds(model, newLo, newHi);
+
+  // Native SOS2 and piecewise-linear y = f(x)
+  addSOS2(model, lambda.slice(i, all));
+  addPWL(model, x(i), y(i), xs, ys, "cost");
+  addPWL(model, std::span<const GRBVar>(X.data(), n), std::span<const GRBVar>(Y.data(), n),
+      points, xsAll, ysAll, "cost");    // n functions from flat [function][point] arrays
+
   // Logical constraints
   atMostOne(model, I, [&](int i) { return x(i); });
   exactlyOne(model, I, J, [&](int i, int j) { return assign(i,j); });
+
+  // Slices of a VariableGroup
+  exactlyOne(model, assign.slice(i, all), "assign");
+
+  // Partitioned: for each i, exactly one j (one row per i, one addConstrs call)
+  ConstraintGroup assignRows = exactlyOne(model, assign, over(1), "assign");   // assignRows(i)
+  atMostOne(model, X.slice(all, all, t), over(0), "slot");                     // for each j at time t
 */
 
+#include <span>
+#include <tuple>
+#include <memory>
+#include <utility>
+#include <algorithm>
 #include <string>
+#include <vector>
 #include <iostream>
+#include <stdexcept>
+#include <type_traits>
 #include "gurobi_c++.h"
 #include "../indexing/Indexing.h"
+#include "../indexing/Naming.h"
+#include "../indexing/Parallel.h"
+#include "VariableSlice.h"
+#include "ConstraintBatch.h"
+#include "ConstraintGroup.h"
+#include "VariableGroup.h"
+#include "ValueArray.h"
+#include "Attributes.h"
 
 namespace mini::constraint {
 
@@ -52,27 +105,124 @@ namespace mini::constraint {
         return model.addConstr(lhs >= rhs, name);
     }
 
+    /// Queue lhs == rhs in a batch (added at the batch's flush)
+    inline void addEq(ConstraintBatch& batch, const GRBLinExpr& lhs, const GRBLinExpr& rhs,
+        const std::string& name = "") {
+        batch.add(eq(lhs, rhs), name);
+    }
+
+    /// Queue lhs <= rhs in a batch (added at the batch's flush)
+    inline void addLe(ConstraintBatch& batch, const GRBLinExpr& lhs, const GRBLinExpr& rhs,
+        const std::string& name = "") {
+        batch.add(le(lhs, rhs), name);
+    }
+
+    /// Queue lhs >= rhs in a batch (added at the batch's flush)
+    inline void addGe(ConstraintBatch& batch, const GRBLinExpr& lhs, const GRBLinExpr& rhs,
+        const std::string& name = "") {
+        batch.add(ge(lhs, rhs), name);
+    }
+
     // ============================================================================
     // VARIADIC CONSTRAINT BUILDING
     // ============================================================================
 
-    /// Add constraints over multiple dimensions
+    namespace detail {
+
+        /// Shape of a family: one dimension per range, or flat if a range
+        /// cannot report its size
+        template<typename... Ranges>
+        std::vector<size_t> familyShape(size_t rows, const Ranges&... ranges) {
+            std::vector<size_t> shape{ dsl::rangeSize(ranges)... };
+            size_t total = 1;
+            for (size_t n : shape) total *= n;
+            if (total != rows) return { rows };
+            return shape;
+        }
+
+        /// Row name under DEBUG_NAMES (unnamed families stay unnamed). Integer
+        /// indices give base[i,j]; labels and other values are streamed
+        template<typename... Idxs>
+        std::string rowName(const std::string& baseName, const Idxs&... idx) {
+            if constexpr (!DEBUG_NAMES) return std::string();
+            else {
+                if (baseName.empty()) return std::string();
+                if constexpr ((std::is_integral_v<Idxs> && ...)) return naming::nameND(baseName, idx...);
+                else return naming::nameLabels(baseName, idx...);
+            }
+        }
+
+    } // namespace detail
+
+    /// Add constraints with names over multiple dimensions and return their handles.
+    /// Lambdas returning a Row (le / ge / eq) are buffered and added with one
+    /// addConstrs call; GRBTempConstr results are added row by row.
     template<typename F, typename... Ranges>
-    void addConstr(GRBModel& model, F&& f, Ranges&&... ranges) {
-        dsl::forEach([&](auto... idx) {
-            model.addConstr(f(idx...));
+    ConstraintGroup addConstr(GRBModel& model, F&& f, const std::string& baseName, Ranges&&... ranges) {
+        const size_t expected = (dsl::rangeSize(ranges) * ... * size_t{ 1 });
+        ConstraintBatch batch;
+        std::vector<GRBConstr> handles;
+        batch.reserve(expected);
+        dsl::forEach([&](const auto&... idx) {
+            decltype(auto) row = f(idx...);
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(row)>, Row>) {
+                batch.add(row, detail::rowName(baseName, idx...));
+            }
+            else {
+                if (handles.empty()) handles.reserve(expected);
+                handles.push_back(model.addConstr(row, detail::rowName(baseName, idx...)));
+            }
             }, ranges...);
+        if (!batch.empty()) handles = batch.flush(model);
+        const size_t rows = handles.size();
+        return ConstraintGroup(std::move(handles), detail::familyShape(rows, ranges...));
     }
 
-    /// Add constraints with names over multiple dimensions
+    /// Add constraints over multiple dimensions (no names)
     template<typename F, typename... Ranges>
-    void addConstr(GRBModel& model, F&& f, const std::string& baseName, Ranges&&... ranges) {
-        dsl::forEach([&](auto... idx) {
-            std::string name = naming::nameND(baseName, idx...);
-            model.addConstr(f(idx...), name);
+        requires (!std::is_convertible_v<std::tuple_element_t<0, std::tuple<Ranges..., int>>, std::string>)
+    ConstraintGroup addConstr(GRBModel& model, F&& f, Ranges&&... ranges) {
+        return addConstr(model, std::forward<F>(f), std::string(), std::forward<Ranges>(ranges)...);
+    }
+
+    /// Queue a constraint family in a batch; handles and reductions (e.g.
+    /// singleton rows turned into bounds) come with the batch's flush
+    template<typename F, typename... Ranges>
+    void addConstr(ConstraintBatch& batch, F&& f, const std::string& baseName, Ranges&&... ranges) {
+        FamilyScope family(batch, baseName);
+        batch.reserve(batch.rows() + (dsl::rangeSize(ranges) * ... * size_t{ 1 }));
+        dsl::forEach([&](const auto&... idx) {
+            batch.add(f(idx...), detail::rowName(baseName, idx...));
             }, ranges...);
     }
 
+    /// Generate a constraint family in parallel: f must return a Row and must
+    /// not touch the model. Each chunk of the iteration space fills its own
+    /// buffer; the calling thread then adds all buffers in iteration order
+    /// with one addConstrs call, so the row order matches the sequential build.
+    template<typename F, typename... Ranges>
+    ConstraintGroup addConstr(const dsl::Parallel& policy, GRBModel& model, F&& f, const std::string& baseName, const Ranges&... ranges) {
+        std::vector<ConstraintBatch> parts;
+        dsl::forEachChunk(policy,
+            [&](size_t chunks) { parts.resize(chunks); },
+            [&](size_t chunk, const auto&... idx) {
+                decltype(auto) row = f(idx...);
+                static_assert(std::is_same_v<std::remove_cvref_t<decltype(row)>, Row>,
+                    "addConstr(par, ...): lambda must return a Row (le / ge / eq)");
+                parts[chunk].add(row, detail::rowName(baseName, idx...));
+            }, ranges...);
+        std::vector<GRBConstr> handles = ConstraintBatch::flushAll(model, parts);
+        const size_t rows = handles.size();
+        return ConstraintGroup(std::move(handles), detail::familyShape(rows, ranges...));
+    }
+
+    /// Unnamed parallel constraint family
+    template<typename F, typename... Ranges>
+        requires (!std::is_convertible_v<std::tuple_element_t<0, std::tuple<Ranges..., int>>, std::string>)
+    ConstraintGroup addConstr(const dsl::Parallel& policy, GRBModel& model, F&& f, const Ranges&... ranges) {
+        return addConstr(policy, model, std::forward<F>(f), std::string(), ranges...);
+    }
+
     // ============================================================================
     // LOGICAL AND INDICATOR CONSTRAINTS
     // ============================================================================
@@ -94,8 +244,22 @@ namespace mini::constraint {
     // CARDINALITY CONSTRAINTS (Variadic versions)
     // ============================================================================
 
+    /// Dimensions of a group / slice that each partitioned row sums over;
+    /// one row is added per index of the remaining dimensions
+    struct Over {
+        std::vector<int> dims;
+    };
+
+    /// over(1): for each i, sum over j of X(i, j)
+    template<typename... Dims>
+    Over over(Dims... dims) {
+        static_assert((std::is_integral_v<Dims> && ...), "over() takes dimension numbers");
+        return Over{ { static_cast<int>(dims)... } };
+    }
+
     /// At most one variable in the set can be true (multi-dimensional)
     template<typename F, typename... Ranges>
+        requires (!dsl::is_var_view_v<F> && !(std::is_same_v<std::remove_cvref_t<Ranges>, Over> || ...))
     void atMostOne(GRBModel& model, F&& f, Ranges&&... ranges) {
         GRBLinExpr sumExpr = dsl::sum(f, ranges...);
         model.addConstr(sumExpr <= 1);
@@ -103,11 +267,123 @@ namespace mini::constraint {
 
     /// Exactly one variable in the set must be true (multi-dimensional)
     template<typename F, typename... Ranges>
+        requires (!dsl::is_var_view_v<F> && !(std::is_same_v<std::remove_cvref_t<Ranges>, Over> || ...))
     void exactlyOne(GRBModel& model, F&& f, Ranges&&... ranges) {
         GRBLinExpr sumExpr = dsl::sum(f, ranges...);
         model.addConstr(sumExpr == 1);
     }
 
+    /// At most one variable of a slice can be true
+    inline GRBConstr atMostOne(GRBModel& model, const VariableSlice& view, const std::string& name = "") {
+        return model.addConstr(dsl::sum(view) <= 1, name);
+    }
+
+    /// Exactly one variable of a slice must be true
+    inline GRBConstr exactlyOne(GRBModel& model, const VariableSlice& view, const std::string& name = "") {
+        return model.addConstr(dsl::sum(view) == 1, name);
+    }
+
+    // ============================================================================
+    // PARTITIONED CARDINALITY CONSTRAINTS
+    // ============================================================================
+
+    namespace detail {
+
+        /// Queue sum(view over `over`) (sense) rhs for every index of the kept
+        /// dimensions. The view is walked once in storage order; each element
+        /// lands directly in its row's slot. Returns the shape of the kept dimensions.
+        inline std::vector<size_t> addPartitioned(ConstraintBatch& batch, const VariableSlice& view, const Over& over,
+            char sense, double rhs, const std::string& baseName) {
+            const int rank = view.dimension();
+            std::vector<char> summed(static_cast<size_t>(rank), 0);
+            for (int d : over.dims) {
+                if (d < 0 || d >= rank) throw std::out_of_range("over(): dimension out of range");
+                if (summed[d]) throw std::invalid_argument("over(): dimension listed twice");
+                summed[d] = 1;
+            }
+
+            // Row-major strides of the kept (row index) and summed (term position) dimensions
+            std::vector<size_t> keptShape, weight(static_cast<size_t>(rank));
+            size_t rows = 1, width = 1;
+            for (int d = rank; d-- > 0;) {
+                size_t& count = summed[d] ? width : rows;
+                weight[d] = count;
+                count *= view.extent(d);
+                if (!summed[d]) keptShape.insert(keptShape.begin(), view.extent(d));
+            }
+            if (rows == 0) return keptShape;
+
+            std::vector<GRBVar> cols(rows * width);
+            std::vector<size_t> idx(static_cast<size_t>(rank), 0);
+            view.forEachVar([&](const GRBVar& v) {
+                size_t row = 0, pos = 0;
+                for (int d = 0; d < rank; ++d) (summed[d] ? pos : row) += idx[d] * weight[d];
+                cols[row * width + pos] = v;
+                for (int d = rank; d-- > 0;) {
+                    if (++idx[d] < view.extent(d)) break;
+                    idx[d] = 0;
+                }
+                });
+
+            const std::vector<double> ones(width, 1.0);
+            const FlatShape rowShape(keptShape);
+            batch.reserve(batch.rows() + rows, batch.nonzeros() + rows * width);
+            for (size_t r = 0; r < rows; ++r) {
+                std::string name;
+                if constexpr (DEBUG_NAMES) {
+                    if (!baseName.empty()) name = naming::nameND(baseName, rowShape.unravel(r));
+                }
+                batch.add(std::span<const GRBVar>(cols.data() + r * width, width), ones, sense, rhs, name);
+            }
+            return keptShape;
+        }
+
+        inline ConstraintGroup addPartitioned(GRBModel& model, const VariableSlice& view, const Over& over,
+            char sense, const std::string& baseName) {
+            ConstraintBatch batch;
+            std::vector<size_t> shape = addPartitioned(batch, view, over, sense, 1.0, baseName);
+            return ConstraintGroup(batch.flush(model), std::move(shape));
+        }
+
+    } // namespace detail
+
+    /// For every index of the other dimensions, exactly one variable over the
+    /// `over` dimensions is true; all rows added with one addConstrs call
+    inline ConstraintGroup exactlyOne(GRBModel& model, const VariableSlice& view, const Over& over,
+        const std::string& baseName = "") {
+        return detail::addPartitioned(model, view, over, GRB_EQUAL, baseName);
+    }
+
+    inline ConstraintGroup exactlyOne(GRBModel& model, VariableGroup& group, const Over& over,
+        const std::string& baseName = "") {
+        return exactlyOne(model, group.slice(), over, baseName);
+    }
+
+    /// For every index of the other dimensions, at most one variable over the
+    /// `over` dimensions is true; all rows added with one addConstrs call
+    inline ConstraintGroup atMostOne(GRBModel& model, const VariableSlice& view, const Over& over,
+        const std::string& baseName = "") {
+        return detail::addPartitioned(model, view, over, GRB_LESS_EQUAL, baseName);
+    }
+
+    inline ConstraintGroup atMostOne(GRBModel& model, VariableGroup& group, const Over& over,
+        const std::string& baseName = "") {
+        return atMostOne(model, group.slice(), over, baseName);
+    }
+
+    /// Queue the partitioned rows in a batch (added at the batch's flush)
+    inline void exactlyOne(ConstraintBatch& batch, const VariableSlice& view, const Over& over,
+        const std::string& baseName = "") {
+        FamilyScope family(batch, baseName);
+        detail::addPartitioned(batch, view, over, GRB_EQUAL, 1.0, baseName);
+    }
+
+    inline void atMostOne(ConstraintBatch& batch, const VariableSlice& view, const Over& over,
+        const std::string& baseName = "") {
+        FamilyScope family(batch, baseName);
+        detail::addPartitioned(batch, view, over, GRB_LESS_EQUAL, 1.0, baseName);
+    }
+
     // ============================================================================
     // BIG-M CONSTRAINTS
     // ============================================================================
@@ -124,6 +400,348 @@ namespace mini::constraint {
         model.addConstr(lhs >= rhs - M * (1 - bin), name);
     }
 
+    /// Row that must hold only when bin = 1 (input of the automatic big-M family)
+    struct Conditional {
+        GRBVar bin;
+        Row row;
+    };
+
+    /// bin = 1 => row
+    inline Conditional onlyIf(const GRBVar& bin, const Row& row) { return Conditional{ bin, row }; }
+
+    /// Constraint family built with automatic M values
+    struct BigMFamily {
+        ConstraintGroup constrs;          ///< Handles, laid out like the ranges
+        ValueArray M;                     ///< Chosen M per row, same layout
+
+        /// Largest M used in the family
+        double maxM() const {
+            double m = 0.0;
+            for (double v : M) m = std::max(m, v);
+            return m;
+        }
+    };
+
+    namespace detail {
+
+        /// Smallest M such that row relaxed by M always holds, from interval
+        /// arithmetic over bounds lb[k], ub[k] of the row's k-th term
+        inline double requiredM(const Row& row, const double* lb, const double* ub) {
+            const unsigned n = row.lhs.size();
+            double lo = row.lhs.getConstant(), hi = lo;
+            for (unsigned k = 0; k < n; ++k) {
+                const double c = row.lhs.getCoeff(k);
+                if (c == 0.0) continue;
+                if (lb[k] <= -GRB_INFINITY || ub[k] >= GRB_INFINITY) {
+                    throw std::runtime_error("conBigM: cannot derive M, row contains an unbounded variable");
+                }
+                lo += c > 0 ? c * lb[k] : c * ub[k];
+                hi += c > 0 ? c * ub[k] : c * lb[k];
+            }
+            if (row.sense == GRB_LESS_EQUAL) return std::max(0.0, hi - row.rhs);
+            if (row.sense == GRB_GREATER_EQUAL) return std::max(0.0, row.rhs - lo);
+            throw std::invalid_argument("conBigM: equality rows need one <= and one >= family");
+        }
+
+        /// Variables of each row back to back, and their current bounds (one
+        /// array query per bound; update() only if a variable is still pending,
+        /// so bound changes not yet flushed by an update() are not seen)
+        inline void rowBounds(GRBModel& model, const std::vector<const Row*>& rows,
+            std::vector<double>& lb, std::vector<double>& ub) {
+            std::vector<GRBVar> cols;
+            size_t nnz = 0;
+            for (const Row* r : rows) nnz += r->lhs.size();
+            cols.reserve(nnz);
+            for (const Row* r : rows) {
+                for (unsigned k = 0; k < r->lhs.size(); ++k) cols.push_back(r->lhs.getVar(k));
+            }
+            if (std::any_of(cols.begin(), cols.end(), [](const GRBVar& v) { return v.index() < 0; })) model.update();
+            lb = attr::get(model, GRB_DoubleAttr_LB, cols.data(), cols.size());
+            ub = attr::get(model, GRB_DoubleAttr_UB, cols.data(), cols.size());
+        }
+
+    } // namespace detail
+
+    /// Big-M constraint bin = 1 => (lhs <= rhs) with the smallest valid M
+    /// computed from the current variable bounds; returns the M used.
+    /// For one-off rows: each call queries the bounds (and runs update() if a
+    /// variable is still pending), so build families with conBigM(...) instead.
+    inline double conBigM_Le(GRBModel& model, const GRBLinExpr& lhs, const GRBLinExpr& rhs,
+        const GRBVar& bin, const std::string& name = "") {
+        const Row row = le(lhs, rhs);
+        std::vector<double> lb, ub;
+        detail::rowBounds(model, { &row }, lb, ub);
+        const double M = detail::requiredM(row, lb.data(), ub.data());
+        conBigM_Le(model, lhs, rhs, bin, M, name);
+        return M;
+    }
+
+    /// Big-M constraint bin = 1 => (lhs >= rhs) with the smallest valid M
+    /// computed from the current variable bounds; returns the M used.
+    /// For one-off rows, like conBigM_Le; use conBigM(...) for families.
+    inline double conBigM_Ge(GRBModel& model, const GRBLinExpr& lhs, const GRBLinExpr& rhs,
+        const GRBVar& bin, const std::string& name = "") {
+        const Row row = ge(lhs, rhs);
+        std::vector<double> lb, ub;
+        detail::rowBounds(model, { &row }, lb, ub);
+        const double M = detail::requiredM(row, lb.data(), ub.data());
+        conBigM_Ge(model, lhs, rhs, bin, M, name);
+        return M;
+    }
+
+    /// Big-M family: f returns onlyIf(bin, le(...) / ge(...)). M is derived per
+    /// row from the variable bounds (fetched in bulk after at most one update())
+    /// and the rows are added with one addConstrs call.
+    template<typename F, typename... Ranges>
+    BigMFamily conBigM(GRBModel& model, F&& f, const std::string& baseName, Ranges&&... ranges) {
+        std::vector<Conditional> conds;
+        std::vector<std::string> names;
+        conds.reserve((dsl::rangeSize(ranges) * ... * size_t{ 1 }));
+        dsl::forEach([&](const auto&... idx) {
+            conds.push_back(f(idx...));
+            if constexpr (DEBUG_NAMES) names.push_back(detail::rowName(baseName, idx...));
+            }, ranges...);
+
+        std::vector<const Row*> rows;
+        rows.reserve(conds.size());
+        for (const auto& c : conds) rows.push_back(&c.row);
+        std::vector<double> lb, ub;
+        detail::rowBounds(model, rows, lb, ub);
+
+        // lhs + M*bin <= rhs + M   /   lhs - M*bin >= rhs - M
+        ConstraintBatch batch;
+        batch.reserve(conds.size(), lb.size() + conds.size());
+        std::vector<double> Ms(conds.size());
+        size_t p = 0;
+        for (size_t r = 0; r < conds.size(); ++r) {
+            const Row& row = conds[r].row;
+            const double M = detail::requiredM(row, lb.data() + p, ub.data() + p);
+            p += row.lhs.size();
+            Ms[r] = M;
+            const double coef = row.sense == GRB_LESS_EQUAL ? M : -M;
+            GRBLinExpr lhs = row.lhs;
+            lhs.addTerms(&coef, &conds[r].bin, 1);
+            batch.add(lhs, row.sense, row.rhs + coef, names.empty() ? std::string() : names[r]);
+        }
+
+        std::vector<GRBConstr> handles = batch.flush(model);
+        FlatShape shape(detail::familyShape(handles.size(), ranges...));
+        ValueArray chosen(std::move(Ms), shape);
+        return BigMFamily{ ConstraintGroup(std::move(handles), shape.dims()), std::move(chosen) };
+    }
+
+    // ============================================================================
+    // RANGE CONSTRAINTS
+    // ============================================================================
+
+    /// lo <= expr <= hi (input of the range builders)
+    struct Band {
+        GRBLinExpr expr;
+        double lo = 0.0;
+        double hi = 0.0;
+    };
+
+    /// Band lo <= expr <= hi
+    inline Band between(double lo, const GRBLinExpr& expr, double hi) { return Band{ expr, lo, hi }; }
+
+    /// Ranged rows expr - s == lo with a slack s in [0, hi - lo] per row, so
+    /// each band is one row and both ends can be moved in bulk
+    struct RangeFamily {
+        ConstraintGroup rows;             ///< One equality row per band
+        VariableGroup slack;              ///< Range slack per band, same layout
+
+        /// Lower ends (row RHS), one array query
+        ValueArray lower(GRBModel& model) const { return rows.rhs(model); }
+
+        /// Upper ends (RHS + slack UB), two array queries
+        ValueArray upper(GRBModel& model) const {
+            ValueArray lo = rows.rhs(model);
+            ValueArray width = slack.values(model, GRB_DoubleAttr_UB);
+            for (size_t p = 0; p < lo.size(); ++p) lo[p] += width[p];
+            return lo;
+        }
+
+        /// Move both ends of every band: one RHS set and one slack UB set
+        void setBounds(GRBModel& model, std::span<const double> lo, std::span<const double> hi) {
+            if (lo.size() != rows.size() || hi.size() != rows.size()) {
+                throw std::invalid_argument("RangeFamily::setBounds(): value count does not match family size");
+            }
+            std::vector<double> width(lo.size());
+            for (size_t p = 0; p < lo.size(); ++p) {
+                if (lo[p] > hi[p]) throw std::invalid_argument("RangeFamily::setBounds(): lower end above upper end");
+                width[p] = hi[p] - lo[p];
+            }
+            rows.setRhs(model, lo);
+            slack.setValues(model, GRB_DoubleAttr_UB, width);
+        }
+    };
+
+    namespace detail {
+
+        /// Slack columns (one addVars call) and rows (one addConstrs call) for bands
+        inline std::pair<std::vector<GRBConstr>, std::vector<GRBVar>> addBands(GRBModel& model,
+            std::vector<Band>& bands, const std::vector<std::string>& names, const std::string& baseName) {
+            const size_t n = bands.size();
+            std::vector<double> lb(n, 0.0), ub(n);
+            for (size_t r = 0; r < n; ++r) {
+                if (bands[r].lo <= -GRB_INFINITY || bands[r].hi >= GRB_INFINITY) {
+                    throw std::invalid_argument("addRange: infinite end, use addLe / addGe for one-sided rows");
+                }
+                if (bands[r].lo > bands[r].hi) throw std::invalid_argument("addRange: lower end above upper end");
+                ub[r] = bands[r].hi - bands[r].lo;
+            }
+            std::vector<std::string> slackNames;
+            if (!names.empty()) {
+                slackNames.reserve(n);
+                for (const auto& nm : names) slackNames.push_back(naming::make_name(baseName, "_slack", nm.substr(baseName.size())));
+            }
+
+            std::vector<GRBVar> slack(n);
+            if (n > 0) {
+                std::unique_ptr<GRBVar[]> created(model.addVars(lb.data(), ub.data(), nullptr, nullptr,
+                    slackNames.empty() ? nullptr : slackNames.data(), static_cast<int>(n)));
+                std::copy(created.get(), created.get() + n, slack.begin());
+            }
+
+            ConstraintBatch batch;
+            batch.reserve(n);
+            const double minusOne = -1.0;
+            for (size_t r = 0; r < n; ++r) {
+                bands[r].expr.addTerms(&minusOne, &slack[r], 1);
+                batch.add(bands[r].expr, GRB_EQUAL, bands[r].lo, names.empty() ? std::string() : names[r]);
+            }
+            return { batch.flush(model), std::move(slack) };
+        }
+
+    } // namespace detail
+
+    /// Single range row lo <= expr <= hi (expression built once, one row)
+    inline RangeFamily addRange(GRBModel& model, const GRBLinExpr& expr, double lo, double hi,
+        const std::string& name = "") {
+        std::vector<Band> bands{ Band{ expr, lo, hi } };
+        std::vector<std::string> names;
+        if constexpr (DEBUG_NAMES) {
+            if (!name.empty()) names.push_back(name);
+        }
+        auto [rows, slack] = detail::addBands(model, bands, names, name);
+        return RangeFamily{ ConstraintGroup(std::move(rows), {}), VariableGroup(std::move(slack), {}) };
+    }
+
+    /// Range family: f returns between(lo, expr, hi); one addVars call for the
+    /// slacks and one addConstrs call for the rows
+    template<typename F, typename... Ranges>
+    RangeFamily addRange(GRBModel& model, F&& f, const std::string& baseName, Ranges&&... ranges) {
+        std::vector<Band> bands;
+        std::vector<std::string> names;
+        bands.reserve((dsl::rangeSize(ranges) * ... * size_t{ 1 }));
+        dsl::forEach([&](const auto&... idx) {
+            bands.push_back(f(idx...));
+            if constexpr (DEBUG_NAMES) {
+                if (!baseName.empty()) names.push_back(detail::rowName(baseName, idx...));
+            }
+            }, ranges...);
+        auto [rows, slack] = detail::addBands(model, bands, names, baseName);
+        const std::vector<size_t> shape = detail::familyShape(rows.size(), ranges...);
+        return RangeFamily{ ConstraintGroup(std::move(rows), shape), VariableGroup(std::move(slack), shape) };
+    }
+
+    // ============================================================================
+    // SOS AND PIECEWISE-LINEAR CONSTRAINTS
+    // ============================================================================
+
+    /// Native SOS set of the given type (GRB_SOS_TYPE1 / GRB_SOS_TYPE2) over a
+    /// slice; weights default to 1, 2, ..., n (row-major order of the slice)
+    inline GRBSOS addSOS(GRBModel& model, int type, const VariableSlice& view, std::span<const double> weights = {}) {
+        std::vector<GRBVar> vs = view.gather();
+        std::vector<double> w;
+        if (weights.empty()) {
+            w.resize(vs.size());
+            for (size_t k = 0; k < w.size(); ++k) w[k] = static_cast<double>(k + 1);
+            weights = w;
+        }
+        if (weights.size() != vs.size()) {
+            throw std::invalid_argument("addSOS(): weight count does not match slice size");
+        }
+        return model.addSOS(vs.data(), weights.data(), static_cast<int>(vs.size()), type);
+    }
+
+    /// At most one nonzero in the slice
+    inline GRBSOS addSOS1(GRBModel& model, const VariableSlice& view, std::span<const double> weights = {}) {
+        return addSOS(model, GRB_SOS_TYPE1, view, weights);
+    }
+
+    /// At most two nonzeros in the slice, and they must be adjacent
+    inline GRBSOS addSOS2(GRBModel& model, const VariableSlice& view, std::span<const double> weights = {}) {
+        return addSOS(model, GRB_SOS_TYPE2, view, weights);
+    }
+
+    /// SOS1 over a whole group
+    inline GRBSOS addSOS1(GRBModel& model, VariableGroup& group, std::span<const double> weights = {}) {
+        return addSOS1(model, group.slice(), weights);
+    }
+
+    /// SOS2 over a whole group
+    inline GRBSOS addSOS2(GRBModel& model, VariableGroup& group, std::span<const double> weights = {}) {
+        return addSOS2(model, group.slice(), weights);
+    }
+
+    namespace detail {
+
+        /// Shared by the single and bulk addPWL, so both accept the same functions
+        inline void requireBreakpoints(size_t count) {
+            if (count < 2) throw std::invalid_argument("addPWL(): each function needs at least 2 breakpoints");
+        }
+
+    } // namespace detail
+
+    /// y = f(x) for the piecewise-linear f through (xs[k], ys[k]); xs non-decreasing,
+    /// at least 2 breakpoints
+    inline GRBGenConstr addPWL(GRBModel& model, const GRBVar& x, const GRBVar& y,
+        std::span<const double> xs, std::span<const double> ys, const std::string& name = "") {
+        if (xs.size() != ys.size()) {
+            throw std::invalid_argument("addPWL(): breakpoint arrays must be of equal length");
+        }
+        detail::requireBreakpoints(xs.size());
+        return model.addGenConstrPWL(x, y, static_cast<int>(xs.size()), xs.data(), ys.data(), name);
+    }
+
+    /// Many PWL functions from contiguous arrays: function k links y[k] = f_k(x[k])
+    /// with breakpoints xs / ys over [offsets[k], offsets[k+1]) (CSR layout).
+    /// Breakpoints are passed straight from the arrays, no per-function copies.
+    inline std::vector<GRBGenConstr> addPWL(GRBModel& model, std::span<const GRBVar> x, std::span<const GRBVar> y,
+        std::span<const size_t> offsets, std::span<const double> xs, std::span<const double> ys,
+        const std::string& baseName = "") {
+        const size_t n = x.size();
+        if (y.size() != n || offsets.size() != n + 1 || xs.size() != ys.size()) {
+            throw std::invalid_argument("addPWL(): array sizes do not match");
+        }
+        if (offsets.front() != 0 || offsets.back() != xs.size()) {
+            throw std::invalid_argument("addPWL(): offsets must start at 0 and end at the breakpoint count");
+        }
+        for (size_t k = 0; k < n; ++k) {
+            if (offsets[k + 1] < offsets[k]) throw std::invalid_argument("addPWL(): offsets must be non-decreasing");
+            detail::requireBreakpoints(offsets[k + 1] - offsets[k]);
+        }
+        std::vector<GRBGenConstr> out;
+        out.reserve(n);
+        for (size_t k = 0; k < n; ++k) {
+            const size_t first = offsets[k], count = offsets[k + 1] - first;
+            out.push_back(addPWL(model, x[k], y[k], xs.subspan(first, count), ys.subspan(first, count),
+                baseName.empty() ? std::string() : naming::nameND(baseName, k)));
+        }
+        return out;
+    }
+
+    /// Many PWL functions with the same number of breakpoints each:
+    /// xs / ys are row-major [function][point] arrays of x.size() * points values
+    inline std::vector<GRBGenConstr> addPWL(GRBModel& model, std::span<const GRBVar> x, std::span<const GRBVar> y,
+        size_t points, std::span<const double> xs, std::span<const double> ys,
+        const std::string& baseName = "") {
+        std::vector<size_t> offsets(x.size() + 1);
+        for (size_t k = 0; k <= x.size(); ++k) offsets[k] = k * points;
+        return addPWL(model, x, y, offsets, xs, ys, baseName);
+    }
+
     // ============================================================================
     // MIN/MAX RELATIONSHIPS (Variadic versions)
     // ============================================================================
@@ -0,0 +1,141 @@
+#pragma once
+/*
+ConstraintGroup.h
+Flat N-D container for GRBConstr handles of one constraint family.
+
+Features:
+- Single contiguous row-major buffer, same layout rules as VariableGroup
+- Element access via at(i,j,k) / operator()
+- Bulk Pi, Slack, RHS (or any double attribute) with one array call
+
+Examples:
+  ConstraintGroup cap = addConstr(model, [&](int i, int j) { return le(x(i,j), c(i)); }, "cap", I, J);
+
+  GRBConstr& r = cap(i, j);
+
+  // Sensitivity analysis after optimize()
+  ValueArray pi = cap.pi(model);                     // pi(i, j)
+  ValueArray slack = cap.slack(model);
+  ValueArray row = cap.sliceValues(model, GRB_DoubleAttr_Pi, i);   // cap(i, :)
+
+  // Update right-hand sides in one call
+  cap.setValues(model, GRB_DoubleAttr_RHS, newRhs);  // contiguous row-major array
+*/
+
+#include <span>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+#include "gurobi_c++.h"
+#include "FlatShape.h"
+#include "ValueArray.h"
+#include "Attributes.h"
+
+namespace mini {
+
+    class ConstraintGroup {
+        std::vector<GRBConstr> constrs;   ///< Row-major element storage
+        FlatShape layout;                 ///< Extents and strides
+
+    public:
+        /// Empty family
+        ConstraintGroup() : layout(std::vector<size_t>{ 0 }) {}
+
+        /// Wrap a row-major buffer of handles with the given extents
+        ConstraintGroup(std::vector<GRBConstr>&& data, std::vector<size_t> shape)
+            : constrs(std::move(data)), layout(std::move(shape)) {
+            if (constrs.size() != layout.size()) {
+                throw std::invalid_argument("ConstraintGroup: handle count does not match shape");
+            }
+        }
+
+        /// Number of dimensions
+        int dimension() const { return layout.rank(); }
+
+        /// Total number of rows
+        size_t size() const { return constrs.size(); }
+
+        /// Size of dimension d
+        size_t extent(int d) const { return layout.extent(d); }
+
+        /// Extents of all dimensions
+        const std::vector<size_t>& shape() const { return layout.dims(); }
+
+        const FlatShape& flatShape() const { return layout; }
+
+        /// Contiguous row-major storage
+        GRBConstr* data() { return constrs.data(); }
+        const GRBConstr* data() const { return constrs.data(); }
+
+        GRBConstr* begin() { return constrs.data(); }
+        GRBConstr* end() { return constrs.data() + constrs.size(); }
+        const GRBConstr* begin() const { return constrs.data(); }
+        const GRBConstr* end() const { return constrs.data() + constrs.size(); }
+
+        /// Access element with bounds checking
+        template<typename... Indices>
+        GRBConstr& at(Indices... idx) { return constrs[offset(idx...)]; }
+
+        template<typename... Indices>
+        const GRBConstr& at(Indices... idx) const { return constrs[offset(idx...)]; }
+
+        /// Operator() syntax for cleaner code
+        template<typename... I> GRBConstr& operator()(I... idx) { return at(idx...); }
+        template<typename... I> const GRBConstr& operator()(I... idx) const { return at(idx...); }
+
+        /// Row-major flat offset of an element (bounds checked)
+        template<typename... Indices>
+        size_t offset(Indices... idx) const {
+            static_assert((std::is_integral_v<Indices> && ...), "Indices must be integral.");
+            if (constrs.empty()) throw std::out_of_range("ConstraintGroup is empty");
+            if (static_cast<int>(sizeof...(idx)) != layout.rank()) {
+                throw std::runtime_error("ConstraintGroup::at(): wrong number of indices");
+            }
+            return layout.offset(idx...);
+        }
+
+        // ============================================================================
+        // BULK ATTRIBUTE ACCESS
+        // ============================================================================
+
+        /// Attribute values of the whole family in one query
+        ValueArray values(GRBModel& model, GRB_DoubleAttr attr) const {
+            return ValueArray(attr::get(model, attr, constrs.data(), constrs.size()), layout);
+        }
+
+        /// Attribute values of the contiguous block C(lead..., :, ..., :) in one query
+        template<typename... Leading>
+        ValueArray sliceValues(GRBModel& model, GRB_DoubleAttr attr, Leading... lead) const {
+            const size_t begin = layout.blockOffset(lead...);
+            FlatShape block = layout.trailing(sizeof...(lead));
+            return ValueArray(attr::get(model, attr, constrs.data() + begin, block.size()), std::move(block));
+        }
+
+        /// Duals (after optimize() of a continuous model)
+        ValueArray pi(GRBModel& model) const { return values(model, GRB_DoubleAttr_Pi); }
+
+        /// Row slacks
+        ValueArray slack(GRBModel& model) const { return values(model, GRB_DoubleAttr_Slack); }
+
+        /// Right-hand sides
+        ValueArray rhs(GRBModel& model) const { return values(model, GRB_DoubleAttr_RHS); }
+
+        /// Set an attribute (RHS, ...) from a row-major array in one call
+        void setValues(GRBModel& model, GRB_DoubleAttr attr, std::span<const double> values) {
+            if (values.size() != constrs.size()) {
+                throw std::invalid_argument("ConstraintGroup::setValues(): value count does not match group size");
+            }
+            attr::set(model, attr, constrs.data(), values.data(), constrs.size());
+        }
+
+        /// Set the same attribute value on every row
+        void fill(GRBModel& model, GRB_DoubleAttr attr, double value) {
+            std::vector<double> buf(constrs.size(), value);
+            attr::set(model, attr, constrs.data(), buf.data(), buf.size());
+        }
+
+        /// Set the right-hand sides from a row-major array in one call
+        void setRhs(GRBModel& model, std::span<const double> values) { setValues(model, GRB_DoubleAttr_RHS, values); }
+    };
+
+} // namespace mini
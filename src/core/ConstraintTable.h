@@ -0,0 +1,65 @@
+#pragma once
+/*
+ConstraintTable.h
+Type-safe storage for constraint families using enum keys.
+
+Features:
+- Compile-time sized table, mirrors VariableTable
+- Type-safe enum access
+- Bulk duals / slacks per family through ConstraintGroup
+
+Examples:
+  enum class Cons { CAPACITY, ASSIGN, COUNT };
+  ConstraintTable<Cons, (size_t)Cons::COUNT> cons;
+
+  // Store families
+  cons.set(Cons::CAPACITY, addConstr(model, [&](int i, int j) { return le(x(i,j), cap(i)); }, "cap", I, J));
+
+  // Access rows
+  GRBConstr& c_ij = cons.constr(Cons::CAPACITY, i, j);
+
+  // Duals of a whole family in one call
+  ValueArray pi = cons(Cons::CAPACITY).pi(model);
+*/
+
+#include <array>
+#include "ConstraintGroup.h"
+
+namespace mini {
+
+    template<typename EnumT, size_t MAX>
+    class ConstraintTable {
+        std::array<ConstraintGroup, MAX> table;
+
+    public:
+        /// Store constraint group
+        void set(EnumT key, ConstraintGroup&& group) {
+            table[static_cast<size_t>(key)] = std::move(group);
+        }
+
+        /// Store a single constraint as a scalar group
+        void set(EnumT key, const GRBConstr& constr) {
+            table[static_cast<size_t>(key)] = ConstraintGroup({ constr }, {});
+        }
+
+        /// Get constraint group reference
+        ConstraintGroup& get(EnumT key) { return table[static_cast<size_t>(key)]; }
+
+        /// Operator() syntax for group access
+        ConstraintGroup& operator()(EnumT key) { return get(key); }
+
+        /// Access a row with indices (scalar if no indices)
+        template<typename... Indices>
+        GRBConstr& constr(EnumT key, Indices... idx) {
+            return table[static_cast<size_t>(key)].at(idx...);
+        }
+
+        /// Number of rows across all families
+        size_t size() const {
+            size_t total = 0;
+            for (const auto& g : table) total += g.size();
+            return total;
+        }
+    };
+
+} // namespace mini
@@ -0,0 +1,91 @@
+#pragma once
+/*
+FlatShape.h
+Row-major layout (extents + strides) shared by the flat N-D containers.
+
+Features:
+- Bounds-checked offset(i,j,k) as one multiply-add per dimension
+- Leading-index blocks map to contiguous [begin, begin + size) ranges
+
+Examples:
+  FlatShape s({10, 20, 30});
+  size_t off = s.offset(i, j, k);       // i*600 + j*30 + k
+  size_t blk = s.blockOffset(i);        // start of the contiguous X(i, :, :) block
+*/
+
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+
+namespace mini {
+
+    class FlatShape {
+        std::vector<size_t> extents;      ///< Size of each dimension
+        std::vector<size_t> strides;      ///< Row-major stride of each dimension
+        size_t total = 1;                 ///< Number of elements
+
+    public:
+        FlatShape() = default;
+
+        explicit FlatShape(std::vector<size_t> shape)
+            : extents(std::move(shape)), strides(extents.size()) {
+            for (size_t d = extents.size(); d-- > 0;) {
+                strides[d] = total;
+                total *= extents[d];
+            }
+        }
+
+        int rank() const { return static_cast<int>(extents.size()); }
+        size_t size() const { return total; }
+        size_t extent(int d) const { return extents.at(static_cast<size_t>(d)); }
+        size_t stride(int d) const { return strides.at(static_cast<size_t>(d)); }
+        const std::vector<size_t>& dims() const { return extents; }
+
+        /// Row-major offset of a full index (bounds checked)
+        template<typename... Indices>
+        size_t offset(Indices... idx) const {
+            if (sizeof...(idx) != extents.size()) {
+                throw std::runtime_error("FlatShape::offset(): wrong number of indices");
+            }
+            return blockOffset(idx...);
+        }
+
+        /// Offset of the contiguous block selected by leading indices
+        template<typename... Indices>
+        size_t blockOffset(Indices... idx) const {
+            static_assert((std::is_integral_v<Indices> && ...), "Indices must be integral.");
+            if (sizeof...(idx) > extents.size()) {
+                throw std::runtime_error("FlatShape: too many indices");
+            }
+            size_t off = 0, d = 0;
+            ((off += strides[d] * checkedIndex(idx, extents[d]), ++d), ...);
+            return off;
+        }
+
+        /// Multi-index of a row-major offset
+        std::vector<int> unravel(size_t off) const {
+            std::vector<int> idx(extents.size());
+            for (size_t d = 0; d < extents.size(); ++d) {
+                idx[d] = static_cast<int>(off / strides[d]);
+                off %= strides[d];
+            }
+            return idx;
+        }
+
+        /// Shape of the block left after fixing `leading` dimensions
+        FlatShape trailing(size_t leading) const {
+            return FlatShape(std::vector<size_t>(extents.begin() + static_cast<std::ptrdiff_t>(leading), extents.end()));
+        }
+
+    private:
+        template<typename I>
+        static size_t checkedIndex(I i, size_t n) {
+            if constexpr (std::is_signed_v<I>) {
+                if (i < 0) throw std::out_of_range("index out of range");
+            }
+            if (static_cast<size_t>(i) >= n) throw std::out_of_range("index out of range");
+            return static_cast<size_t>(i);
+        }
+    };
+
+} // namespace mini
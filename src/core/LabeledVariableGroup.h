@@ -0,0 +1,90 @@
+#pragma once
+/*
+LabeledVariableGroup.h
+N-D variable group indexed by labels (strings, 64-bit IDs, small tuples)
+instead of dense 0..n-1 integers.
+
+Features:
+- One static perfect-hash LabelIndex per dimension, built once
+- X("SKU-1", depotId) resolves labels without allocation or side maps
+- Underlying storage is a regular flat VariableGroup (slices, bulk attributes)
+
+Examples:
+  auto X = VariableFactory::addLabeled(model, GRB_CONTINUOUS, 0, 100, "X", skus, depots);
+
+  model.addConstr(X("SKU-1", 40017) <= 5);
+  if (X.contains(sku, depot)) { ... }
+
+  // Iterate labels directly
+  GRBLinExpr e = sum([&](const std::string& s, int64_t d) { return X(s, d); },
+                     X.labels<0>(), X.labels<1>());
+*/
+
+#include <tuple>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include "gurobi_c++.h"
+#include "../indexing/LabelIndex.h"
+#include "VariableGroup.h"
+
+namespace mini {
+
+    template<typename... Labels>
+    class LabeledVariableGroup {
+        std::tuple<dsl::LabelIndex<Labels>...> indexes;   ///< Label index per dimension
+        VariableGroup group;                              ///< Dense storage by position
+
+    public:
+        LabeledVariableGroup() = default;
+
+        LabeledVariableGroup(VariableGroup&& g, dsl::LabelIndex<Labels>... idx)
+            : indexes(std::move(idx)...), group(std::move(g)) {
+            if (group.dimension() != static_cast<int>(sizeof...(Labels))) {
+                throw std::invalid_argument("LabeledVariableGroup: group rank does not match label dimensions");
+            }
+        }
+
+        static constexpr int dimension() { return static_cast<int>(sizeof...(Labels)); }
+        size_t size() const { return group.size(); }
+
+        /// Access element by labels (throws std::out_of_range for unknown labels)
+        GRBVar& at(const typename dsl::LabelIndex<Labels>::Lookup&... labels) {
+            return atPositions(std::index_sequence_for<Labels...>{}, labels...);
+        }
+
+        /// Operator() syntax for cleaner code
+        GRBVar& operator()(const typename dsl::LabelIndex<Labels>::Lookup&... labels) {
+            return atPositions(std::index_sequence_for<Labels...>{}, labels...);
+        }
+
+        /// True if every label is known
+        bool contains(const typename dsl::LabelIndex<Labels>::Lookup&... labels) const {
+            return containsAll(std::index_sequence_for<Labels...>{}, labels...);
+        }
+
+        /// Label index of dimension D
+        template<size_t D>
+        const auto& index() const { return std::get<D>(indexes); }
+
+        /// Labels of dimension D in position order (usable as a range)
+        template<size_t D>
+        const auto& labels() const { return std::get<D>(indexes).all(); }
+
+        /// Underlying position-indexed group (slices, values, setValues, ...)
+        VariableGroup& positions() { return group; }
+        const VariableGroup& positions() const { return group; }
+
+    private:
+        template<size_t... D, typename... L>
+        GRBVar& atPositions(std::index_sequence<D...>, const L&... labels) {
+            return group.at(std::get<D>(indexes).position(labels)...);
+        }
+
+        template<size_t... D, typename... L>
+        bool containsAll(std::index_sequence<D...>, const L&... labels) const {
+            return (std::get<D>(indexes).contains(labels) && ...);
+        }
+    };
+
+} // namespace mini
@@ -0,0 +1,141 @@
+#pragma once
+/*
+RaggedVariableGroup.h
+2-D variable family whose rows have different lengths (CSR layout).
+
+Features:
+- One contiguous GRBVar buffer plus a row offset table
+- O(1) at(i,j): offsets[i] + j
+- domain() iterates existing (i,j) pairs for dsl::sum / dsl::forEach
+- row(i) is a contiguous VariableSlice (sum, atMostOne, exactlyOne, bulk attributes)
+
+Examples:
+  // Order i has slotCount[i] eligible slots
+  auto X = VariableFactory::addRagged(model, GRB_BINARY, 0, 1, "X", slotCount);
+
+  model.addConstr(X(i, j) <= 1);
+  exactlyOne(model, X.row(i), "assign");
+
+  GRBLinExpr cost = sum([&](int i, int j) { return c[i][j] * X(i, j); }, X.domain());
+*/
+
+#include <span>
+#include <array>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include "gurobi_c++.h"
+#include "../indexing/Indexing.h"
+#include "VariableSlice.h"
+#include "Attributes.h"
+
+namespace mini {
+
+    class RaggedVariableGroup {
+        std::vector<GRBVar> vars;         ///< Row-major element storage
+        std::vector<size_t> offsets;      ///< Row i occupies [offsets[i], offsets[i+1])
+
+    public:
+        /// Lazy range over the existing (i,j) pairs in storage order
+        class Domain {
+            const std::vector<size_t>* offsets = nullptr;
+
+        public:
+            class Iterator {
+                const std::vector<size_t>* off;
+                size_t i, p;
+            public:
+                Iterator(const std::vector<size_t>* o, size_t row, size_t pos) : off(o), i(row), p(pos) { skipEmpty(); }
+                std::array<int, 2> operator*() const {
+                    return { static_cast<int>(i), static_cast<int>(p - (*off)[i]) };
+                }
+                Iterator& operator++() { ++p; skipEmpty(); return *this; }
+                bool operator!=(const Iterator& other) const { return p != other.p; }
+            private:
+                void skipEmpty() {
+                    while (i + 1 < off->size() && p >= (*off)[i + 1]) ++i;
+                }
+            };
+
+            explicit Domain(const std::vector<size_t>& o) : offsets(&o) {}
+            Iterator begin() const { return Iterator(offsets, 0, 0); }
+            Iterator end() const { return Iterator(offsets, offsets->size() - 1, offsets->back()); }
+            size_t size() const { return offsets->back(); }
+        };
+
+        RaggedVariableGroup() : offsets(1, 0) {}
+
+        /// Wrap a CSR buffer (offsets has one entry per row plus a final end offset)
+        RaggedVariableGroup(std::vector<GRBVar>&& data, std::vector<size_t> rowOffsets)
+            : vars(std::move(data)), offsets(std::move(rowOffsets)) {
+            if (offsets.empty() || offsets.front() != 0 || offsets.back() != vars.size()) {
+                throw std::invalid_argument("RaggedVariableGroup: offsets do not match buffer");
+            }
+        }
+
+        /// Number of rows
+        size_t rows() const { return offsets.size() - 1; }
+
+        /// Length of row i
+        size_t rowSize(size_t i) const { return offsets.at(i + 1) - offsets[i]; }
+
+        /// Total number of elements
+        size_t size() const { return vars.size(); }
+
+        /// Row offset table (CSR row pointers)
+        const std::vector<size_t>& rowOffsets() const { return offsets; }
+
+        /// Contiguous storage
+        GRBVar* data() { return vars.data(); }
+        const GRBVar* data() const { return vars.data(); }
+
+        /// Existing (i,j) pairs (usable as a range in dsl::sum / dsl::forEach)
+        Domain domain() const { return Domain(offsets); }
+
+        /// Column indices of row i (usable as a range)
+        dsl::RangeView inner(int i) const { return dsl::indices(static_cast<int>(rowSize(static_cast<size_t>(i)))); }
+
+        /// Access element with bounds checking
+        template<typename I, typename J>
+        GRBVar& at(I i, J j) {
+            static_assert(std::is_integral_v<I> && std::is_integral_v<J>, "Indices must be integral.");
+            if (std::cmp_less(i, 0) || std::cmp_greater_equal(i, rows())) throw std::out_of_range("RaggedVariableGroup index out of range");
+            const size_t first = offsets[static_cast<size_t>(i)];
+            if (std::cmp_less(j, 0) || std::cmp_greater_equal(j, offsets[static_cast<size_t>(i) + 1] - first)) {
+                throw std::out_of_range("RaggedVariableGroup index out of range");
+            }
+            return vars[first + static_cast<size_t>(j)];
+        }
+
+        /// Operator() syntax for cleaner code
+        template<typename I, typename J> GRBVar& operator()(I i, J j) { return at(i, j); }
+
+        /// Contiguous view of row i
+        VariableSlice row(int i) {
+            const size_t r = static_cast<size_t>(i);
+            if (i < 0 || r >= rows()) throw std::out_of_range("RaggedVariableGroup index out of range");
+            return VariableSlice(vars.data() + offsets[r], { rowSize(r) }, { 1 });
+        }
+
+        /// Attribute values (solution X by default) in storage order, one query
+        std::vector<double> values(GRBModel& model, GRB_DoubleAttr attr = GRB_DoubleAttr_X) const {
+            return attr::get(model, attr, vars.data(), vars.size());
+        }
+
+        /// Set an attribute from an array in storage order, one call
+        void setValues(GRBModel& model, GRB_DoubleAttr attr, std::span<const double> values) {
+            if (values.size() != vars.size()) {
+                throw std::invalid_argument("RaggedVariableGroup::setValues(): value count does not match group size");
+            }
+            attr::set(model, attr, vars.data(), values.data(), vars.size());
+        }
+    };
+
+} // namespace mini
+
+namespace mini::dsl {
+
+    template<> struct is_tuple_domain<RaggedVariableGroup::Domain> : std::true_type {};
+
+} // namespace mini::dsl
@@ -0,0 +1,130 @@
+#pragma once
+/*
+SparseVariableGroup.h
+N-D variable family defined only on an explicit set of index tuples.
+
+Features:
+- Stores only the tuples that exist (no dense Cartesian product)
+- Hashed at(i,j) / contains(i,j) lookup
+- domain() iterates existing tuples in sorted order, so dsl::sum and
+  dsl::forEach skip the holes
+
+Examples:
+  // Only compatible (i,j) pairs get a variable
+  auto X = VariableFactory::addSparse(model, GRB_BINARY, 0, 1, "X",
+      [&](int i, int j) { return compatible[i][j]; }, I, J);
+
+  if (X.contains(i, j)) model.addConstr(X(i, j) <= 1);
+
+  // Sum over existing tuples only
+  GRBLinExpr cost = sum([&](int i, int j) { return c[i][j] * X(i, j); }, X.domain());
+*/
+
+#include <span>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <stdexcept>
+#include <type_traits>
+#include "gurobi_c++.h"
+#include "../indexing/Indexing.h"
+#include "Attributes.h"
+
+namespace mini {
+
+    template<size_t N>
+    class SparseVariableGroup {
+    public:
+        using Key = std::array<int, N>;
+
+    private:
+        struct KeyHash {
+            size_t operator()(const Key& k) const {
+                size_t h = 0;
+                for (int v : k) h = h * 1000003u ^ static_cast<size_t>(static_cast<unsigned>(v));
+                return h;
+            }
+        };
+
+        std::vector<Key> keys;                              ///< Sorted, unique tuples
+        std::vector<GRBVar> vars;                           ///< vars[p] belongs to keys[p]
+        std::unordered_map<Key, size_t, KeyHash> position;  ///< Tuple -> storage position
+
+    public:
+        SparseVariableGroup() = default;
+
+        /// Wrap variables for the given tuples (tuples must be sorted and unique)
+        SparseVariableGroup(std::vector<Key>&& tuples, std::vector<GRBVar>&& data)
+            : keys(std::move(tuples)), vars(std::move(data)) {
+            if (keys.size() != vars.size()) {
+                throw std::invalid_argument("SparseVariableGroup: tuple and variable counts differ");
+            }
+            position.reserve(keys.size());
+            for (size_t p = 0; p < keys.size(); ++p) {
+                if (!position.emplace(keys[p], p).second) {
+                    throw std::invalid_argument("SparseVariableGroup: duplicate index tuple");
+                }
+            }
+        }
+
+        static constexpr int dimension() { return static_cast<int>(N); }
+
+        /// Number of existing tuples
+        size_t size() const { return vars.size(); }
+
+        /// Existing tuples in sorted order, as a tuple domain: dsl::sum /
+        /// dsl::forEach pass each tuple as N indices
+        dsl::TupleDomain<std::vector<Key>> domain() const { return dsl::TupleDomain<std::vector<Key>>(keys); }
+
+        /// Contiguous storage, parallel to domain()
+        GRBVar* data() { return vars.data(); }
+        const GRBVar* data() const { return vars.data(); }
+
+        /// True if the tuple exists in the group
+        template<typename... Indices>
+        bool contains(Indices... idx) const {
+            return position.find(makeKey(idx...)) != position.end();
+        }
+
+        /// Pointer to the variable, or nullptr if the tuple does not exist
+        template<typename... Indices>
+        GRBVar* find(Indices... idx) {
+            auto it = position.find(makeKey(idx...));
+            return it == position.end() ? nullptr : &vars[it->second];
+        }
+
+        /// Access existing element (throws if the tuple is absent)
+        template<typename... Indices>
+        GRBVar& at(Indices... idx) {
+            auto it = position.find(makeKey(idx...));
+            if (it == position.end()) throw std::out_of_range("SparseVariableGroup: tuple not in domain");
+            return vars[it->second];
+        }
+
+        /// Operator() syntax for cleaner code
+        template<typename... I> GRBVar& operator()(I... idx) { return at(idx...); }
+
+        /// Attribute values (solution X by default) parallel to domain(), one query
+        std::vector<double> values(GRBModel& model, GRB_DoubleAttr attr = GRB_DoubleAttr_X) const {
+            return attr::get(model, attr, vars.data(), vars.size());
+        }
+
+        /// Set an attribute from an array parallel to domain(), one call
+        void setValues(GRBModel& model, GRB_DoubleAttr attr, std::span<const double> values) {
+            if (values.size() != vars.size()) {
+                throw std::invalid_argument("SparseVariableGroup::setValues(): value count does not match group size");
+            }
+            attr::set(model, attr, vars.data(), values.data(), vars.size());
+        }
+
+    private:
+        template<typename... Indices>
+        static Key makeKey(Indices... idx) {
+            static_assert(sizeof...(idx) == N, "SparseVariableGroup: wrong number of indices");
+            static_assert((std::is_integral_v<Indices> && ...), "Indices must be integral.");
+            return Key{ static_cast<int>(idx)... };
+        }
+    };
+
+} // namespace mini
@@ -0,0 +1,62 @@
+#pragma once
+/*
+ValueArray.h
+Contiguous, shape-aware array of doubles (solution values, duals, ...).
+
+Features:
+- Same row-major layout as the group it was read from
+- Indexed access via v(i,j,k) or flat access via v[p]
+- Exposes the underlying std::vector for bulk post-processing
+
+Examples:
+  ValueArray x = X.values(model);          // one array query for the whole group
+  double xijk = x(i, j, k);
+  double total = std::accumulate(x.begin(), x.end(), 0.0);
+*/
+
+#include <vector>
+#include <stdexcept>
+#include "FlatShape.h"
+
+namespace mini {
+
+    class ValueArray {
+        std::vector<double> vals;         ///< Row-major values
+        FlatShape layout;                 ///< Extents and strides
+
+    public:
+        ValueArray() = default;
+
+        ValueArray(std::vector<double>&& v, FlatShape shape)
+            : vals(std::move(v)), layout(std::move(shape)) {
+            if (vals.size() != layout.size()) {
+                throw std::invalid_argument("ValueArray: value count does not match shape");
+            }
+        }
+
+        int dimension() const { return layout.rank(); }
+        size_t size() const { return vals.size(); }
+        size_t extent(int d) const { return layout.extent(d); }
+        const std::vector<size_t>& shape() const { return layout.dims(); }
+
+        double* data() { return vals.data(); }
+        const double* data() const { return vals.data(); }
+        const std::vector<double>& vector() const { return vals; }
+
+        auto begin() { return vals.begin(); }
+        auto end() { return vals.end(); }
+        auto begin() const { return vals.begin(); }
+        auto end() const { return vals.end(); }
+
+        /// Flat (row-major) access
+        double& operator[](size_t p) { return vals[p]; }
+        double operator[](size_t p) const { return vals[p]; }
+
+        /// Indexed access with bounds checking
+        template<typename... Indices>
+        double& operator()(Indices... idx) { return vals[layout.offset(idx...)]; }
+        template<typename... Indices>
+        double operator()(Indices... idx) const { return vals[layout.offset(idx...)]; }
+    };
+
+} // namespace mini
@@ -6,7 +6,13 @@ Create variables attached to models or as independent handles.
 Features:
 - Single API for scalars and N-D variables
 - Automatic naming with DEBUG_NAMES control
-- Memory-efficient tree construction
+- Flat row-major storage built directly (no intermediate tree)
+- One array-based addVars call per group
+- Per-element bounds, objective and types (arrays or generators)
+- Lazy groups for column generation (materialized on first use)
+- Sparse groups over explicit tuple lists or predicates
+- Ragged groups with per-row sizes (CSR storage)
+- Label-indexed groups (strings, IDs, tuples) with perfect-hash lookup
 
 Examples:
   // Scalar variable
@@ -15,22 +21,39 @@ Examples:
   // 3D variable group
   VariableGroup X = VariableFactory::add(model, GRB_CONTINUOUS, 0, 100, "X", 5, 10, 15);
 
+  // Per-element data: scalars, row-major arrays or generators f(i, j)
+  VariableGroup Z = VariableFactory::add(model, GRB_CONTINUOUS, 0.0,
+      [&](int i, int j) { return cap[i][j]; }, cost, "Z", 5, 10);
+
   // Independent variables (not attached to model)
   VariableGroup Y = VariableFactory::create(GRB_BINARY, 0, 1, "Y", 8, 8);
+
+  // Sparse group: only pairs accepted by the predicate exist
+  auto S = VariableFactory::addSparse(model, GRB_BINARY, 0, 1, "S",
+      [&](int i, int j) { return compatible(i, j); }, I, J);
 */
 
+#include <array>
+#include <memory>
 #include <string>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
 #include <type_traits>
 #include "gurobi_c++.h"
 #include "VariableGroup.h"
-#include "..\indexing\Naming.h"
+#include "SparseVariableGroup.h"
+#include "RaggedVariableGroup.h"
+#include "LabeledVariableGroup.h"
+#include "../indexing/Indexing.h"
+#include "../indexing/Naming.h"
 
 namespace mini {
 
     class VariableFactory {
     public:
-        using Node = VariableGroup::Node;
-
         /// Add variables to a model
         template<typename... Sizes>
         static auto add(GRBModel& model, int vtype, double lb, double ub,
@@ -40,9 +63,109 @@ namespace mini {
                 return model.addVar(lb, ub, 0.0, vtype, name);
             }
             else {
-                Node root = addNode(model, vtype, lb, ub, baseName, sizes...);
-                return VariableGroup(std::move(root), static_cast<int>(sizeof...(sizes)));
+                std::vector<size_t> shape = makeShape(sizes...);
+                const size_t n = totalSize(shape);
+                std::vector<double> lbs(n, lb), ubs(n, ub);
+                std::vector<char> types(n, static_cast<char>(vtype));
+                return addBulk(model, lbs.data(), ubs.data(), nullptr, types.data(),
+                    baseName, std::move(shape));
+            }
+        }
+
+        /// Add variables with per-element data. Each of vtype, lb, ub and obj may be
+        /// a scalar, a contiguous row-major array (std::vector, std::span, ...) or a
+        /// generator f(i, j, ...); every column is created with its final data by
+        /// one addVars call.
+        template<typename VType, typename LB, typename UB, typename Obj, typename... Sizes>
+            requires (sizeof...(Sizes) > 0 && !std::is_convertible_v<const Obj&, std::string>)
+        static VariableGroup add(GRBModel& model, const VType& vtype, const LB& lb, const UB& ub,
+            const Obj& obj, const std::string& baseName, Sizes... sizes) {
+            std::vector<size_t> shape = makeShape(sizes...);
+            const size_t n = totalSize(shape);
+            std::vector<char> types = columnData<char>(vtype, n, sizes...);
+            std::vector<double> lbs = columnData<double>(lb, n, sizes...);
+            std::vector<double> ubs = columnData<double>(ub, n, sizes...);
+            std::vector<double> objs = columnData<double>(obj, n, sizes...);
+            return addBulk(model, lbs.data(), ubs.data(), objs.data(), types.data(),
+                baseName, std::move(shape));
+        }
+
+        /// Declare a lazy group: elements become solver columns only when first
+        /// accessed or when activated and materialized in a batch
+        template<typename... Sizes>
+            requires (sizeof...(Sizes) > 0)
+        static VariableGroup addLazy(GRBModel& model, int vtype, double lb, double ub,
+            const std::string& baseName, Sizes... sizes) {
+            return VariableGroup(model, static_cast<char>(vtype), lb, ub, baseName, makeShape(sizes...));
+        }
+
+        /// Add a ragged 2-D group: row i has rowSizes[i] elements (CSR storage)
+        template<typename Size>
+        static RaggedVariableGroup addRagged(GRBModel& model, int vtype, double lb, double ub,
+            const std::string& baseName, const std::vector<Size>& rowSizes) {
+            static_assert(std::is_integral_v<Size>, "Row sizes must be integral.");
+            std::vector<size_t> offsets(rowSizes.size() + 1, 0);
+            for (size_t i = 0; i < rowSizes.size(); ++i) {
+                if (std::cmp_less(rowSizes[i], 0)) throw std::invalid_argument("VariableFactory::addRagged(): negative row size");
+                offsets[i + 1] = offsets[i] + static_cast<size_t>(rowSizes[i]);
+            }
+            const size_t n = offsets.back();
+
+            std::vector<std::string> names;
+            if constexpr (DEBUG_NAMES) {
+                names.reserve(n);
+                for (size_t i = 0; i < rowSizes.size(); ++i) {
+                    for (size_t j = 0; j < offsets[i + 1] - offsets[i]; ++j) names.push_back(naming::nameND(baseName, i, j));
+                }
+            }
+            std::vector<double> lbs(n, lb), ubs(n, ub);
+            std::vector<char> types(n, static_cast<char>(vtype));
+            std::vector<GRBVar> data = addColumns(model, lbs.data(), ubs.data(), nullptr,
+                types.data(), names, n);
+            return RaggedVariableGroup(std::move(data), std::move(offsets));
+        }
+
+        /// Add a group indexed by labels: one label list per dimension
+        template<typename... Labels>
+            requires (sizeof...(Labels) > 0)
+        static LabeledVariableGroup<Labels...> addLabeled(GRBModel& model, int vtype, double lb, double ub,
+            const std::string& baseName, const std::vector<Labels>&... labels) {
+            VariableGroup group = add(model, vtype, lb, ub, baseName, labels.size()...);
+            return LabeledVariableGroup<Labels...>(std::move(group), dsl::LabelIndex<Labels>(labels)...);
+        }
+
+        /// Add a sparse group defined on an explicit list of index tuples
+        template<size_t N>
+        static SparseVariableGroup<N> addSparse(GRBModel& model, int vtype, double lb, double ub,
+            const std::string& baseName, std::vector<std::array<int, N>> tuples) {
+            std::sort(tuples.begin(), tuples.end());
+            tuples.erase(std::unique(tuples.begin(), tuples.end()), tuples.end());
+            const size_t n = tuples.size();
+
+            std::vector<std::string> names;
+            if constexpr (DEBUG_NAMES) {
+                names.reserve(n);
+                for (const auto& t : tuples) {
+                    names.push_back(naming::nameND(baseName, std::vector<int>(t.begin(), t.end())));
+                }
             }
+            std::vector<double> lbs(n, lb), ubs(n, ub);
+            std::vector<char> types(n, static_cast<char>(vtype));
+            std::vector<GRBVar> data = addColumns(model, lbs.data(), ubs.data(), nullptr,
+                types.data(), names, n);
+            return SparseVariableGroup<N>(std::move(tuples), std::move(data));
+        }
+
+        /// Add a sparse group over the tuples of ranges... for which pred(i, j, ...) is true
+        template<typename Pred, typename Range, typename... Rest>
+        static auto addSparse(GRBModel& model, int vtype, double lb, double ub,
+            const std::string& baseName, Pred&& pred, const Range& first, const Rest&... rest) {
+            constexpr size_t N = 1 + sizeof...(Rest);
+            std::vector<std::array<int, N>> tuples;
+            dsl::forEach([&](auto... idx) {
+                if (pred(idx...)) tuples.push_back({ static_cast<int>(idx)... });
+                }, first, rest...);
+            return addSparse<N>(model, vtype, lb, ub, baseName, std::move(tuples));
         }
 
         /// Create independent variable handles
@@ -52,56 +175,87 @@ namespace mini {
                 return GRBVar();
             }
             else {
-                Node root = createNode(sizes...);
-                return VariableGroup(std::move(root), static_cast<int>(sizeof...(sizes)));
+                std::vector<size_t> shape = makeShape(sizes...);
+                std::vector<GRBVar> data(totalSize(shape));
+                return VariableGroup(std::move(data), std::move(shape));
             }
         }
 
     private:
-        // Implementation details...
-        template<typename SizeType>
-        static Node addNode(GRBModel& model, int vtype, double lb, double ub,
-            const std::string& name, SizeType n) {
-            static_assert(std::is_integral_v<SizeType>);
-            Node node(static_cast<size_t>(n));
-            for (SizeType i = 0; i < n; ++i) {
-                std::string varName = naming::nameND(name, i);
-                node.children[static_cast<size_t>(i)] = Node(model.addVar(lb, ub, 0.0, vtype, varName));
+        // Create every column of a group with one array-based addVars call.
+        // Null lb/ub/obj/type arrays take Gurobi's defaults.
+        static VariableGroup addBulk(GRBModel& model, const double* lb, const double* ub,
+            const double* obj, const char* type, const std::string& baseName,
+            std::vector<size_t> shape) {
+            const size_t n = totalSize(shape);
+            std::vector<std::string> names;
+            if constexpr (DEBUG_NAMES) {
+                names.reserve(n);
+                std::vector<int> idx(shape.size(), 0);
+                for (size_t k = 0; k < n; ++k) {
+                    names.push_back(naming::nameND(baseName, idx));
+                    nextIndex(idx, shape);
+                }
             }
-            return node;
+            std::vector<GRBVar> data = addColumns(model, lb, ub, obj, type, names, n);
+            return VariableGroup(std::move(data), std::move(shape));
         }
 
-        template<typename SizeType, typename... Sizes>
-        static Node addNode(GRBModel& model, int vtype, double lb, double ub,
-            const std::string& name, SizeType n, Sizes... sizes) {
-            static_assert(std::is_integral_v<SizeType>);
-            Node node(static_cast<size_t>(n));
-            for (SizeType i = 0; i < n; ++i) {
-                std::string subName = naming::nameND(name, i);
-                node.children[static_cast<size_t>(i)] = addNode(model, vtype, lb, ub, subName, sizes...);
+        // Single addVars call; names may be empty (no name buffer passed)
+        static std::vector<GRBVar> addColumns(GRBModel& model, const double* lb, const double* ub,
+            const double* obj, const char* type, const std::vector<std::string>& names, size_t n) {
+            std::vector<GRBVar> data;
+            if (n > 0) {
+                std::unique_ptr<GRBVar[]> created(model.addVars(lb, ub, obj, type,
+                    names.empty() ? nullptr : names.data(), static_cast<int>(n)));
+                data.assign(created.get(), created.get() + n);
             }
-            return node;
+            return data;
         }
 
-        template<typename SizeType>
-        static Node createNode(SizeType n) {
-            static_assert(std::is_integral_v<SizeType>);
-            Node node(static_cast<size_t>(n));
-            for (SizeType i = 0; i < n; ++i) {
-                node.children[static_cast<size_t>(i)] = Node(GRBVar());
+        // Expand a scalar, row-major array or generator into one value per element
+        template<typename T, typename Arg, typename... Sizes>
+        static std::vector<T> columnData(const Arg& arg, size_t n, Sizes... sizes) {
+            std::vector<T> out;
+            if constexpr (std::is_arithmetic_v<Arg>) {
+                out.assign(n, static_cast<T>(arg));
+            }
+            else if constexpr (std::is_invocable_v<const Arg&, decltype(static_cast<int>(sizes))...>) {
+                out.reserve(n);
+                dsl::forEach([&](auto... idx) {
+                    out.push_back(static_cast<T>(arg(idx...)));
+                    }, dsl::indices(static_cast<int>(sizes))...);
             }
-            return node;
+            else {
+                if (static_cast<size_t>(std::size(arg)) != n) {
+                    throw std::invalid_argument("VariableFactory::add(): per-element data size does not match group size");
+                }
+                out.reserve(n);
+                for (const auto& v : arg) out.push_back(static_cast<T>(v));
+            }
+            return out;
+        }
+
+        // Implementation details...
+        template<typename... Sizes>
+        static std::vector<size_t> makeShape(Sizes... sizes) {
+            static_assert((std::is_integral_v<Sizes> && ...), "Sizes must be integral.");
+            return { static_cast<size_t>(sizes)... };
+        }
+
+        static size_t totalSize(const std::vector<size_t>& shape) {
+            size_t total = 1;
+            for (size_t n : shape) total *= n;
+            return total;
         }
 
-        template<typename SizeType, typename... Sizes>
-        static Node createNode(SizeType n, Sizes... sizes) {
-            static_assert(std::is_integral_v<SizeType>);
-            Node node(static_cast<size_t>(n));
-            for (SizeType i = 0; i < n; ++i) {
-                node.children[static_cast<size_t>(i)] = createNode(sizes...);
+        // Advance a row-major multi-index (last dimension fastest)
+        static void nextIndex(std::vector<int>& idx, const std::vector<size_t>& shape) {
+            for (size_t d = idx.size(); d-- > 0;) {
+                if (static_cast<size_t>(++idx[d]) < shape[d]) return;
+                idx[d] = 0;
             }
-            return node;
         }
     };
 
-} // namespace mini
\ No newline at end of file
+} // namespace mini
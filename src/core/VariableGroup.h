@@ -1,12 +1,16 @@
 #pragma once
 /*
 VariableGroup.h
-Recursive N-D container for GRBVar with zero-copy access.
+Flat N-D container for GRBVar with zero-copy access.
 
 Features:
-- Scalar (0-D) and N-D nested variables
-- Zero-overhead element access via at(i,j,k)
-- Memory-efficient tree structure
+- Scalar (0-D) and N-D variables
+- Single contiguous row-major buffer (no per-element allocation)
+- Element access via at(i,j,k) is one multiply-add per dimension
+- Bulk solution extraction and attribute setting with one array call
+- Zero-copy slicing views: X.slice(i, all, k)
+- Optional lazy mode: columns created on first use, in batches; copies of a
+  lazy group share its state, so an element is only ever created once
 
 Examples:
   // Create 3D variable group
@@ -15,70 +19,353 @@ Examples:
   // Access elements
   model.addConstr(X.at(i, j, k) == 1);
   model.addConstr(X(i, j, k) <= 0.5);  // Operator() syntax
+
+  // Raw storage (row-major, last index fastest)
+  GRBVar* first = X.data();
+  size_t n = X.size();                  // 10 * 20 * 30
+
+  // Solution values after optimize()
+  ValueArray x = X.values(model);       // x(i, j, k)
+  ValueArray row = X.sliceValues(model, GRB_DoubleAttr_X, i);  // X(i, :, :)
+
+  // Warm start / bounds for the whole group in one call
+  X.setValues(model, GRB_DoubleAttr_Start, start);             // contiguous row-major array
+  X.setValues(model, GRB_DoubleAttr_UB, [&](int i, int j, int k) { return cap[k]; }, I, J, K);
+  X.fill(model, GRB_DoubleAttr_Obj, 1.0);
+
+  // Lazy group (column generation): nothing is added to the model yet
+  VariableGroup L = VariableFactory::addLazy(model, GRB_CONTINUOUS, 0, 1, "L", 100, 50);
+  L.activate(3, 7); L.activate(4, 2);   // queue
+  L.materialize();                      // one addVars call for both
+  GRBVar& l = L(9, 9);                  // first access materializes it
+  VariableGroup alias = L;              // copies share L's columns and state
 */
 
+#include <span>
+#include <memory>
+#include <string>
 #include <vector>
+#include <utility>
 #include <stdexcept>
 #include <type_traits>
 #include "gurobi_c++.h"
+#include "../indexing/Indexing.h"
+#include "../indexing/Naming.h"
+#include "FlatShape.h"
+#include "ValueArray.h"
+#include "VariableSlice.h"
+#include "Attributes.h"
 
 namespace mini {
 
     class VariableGroup {
-    public:
-        struct Node {
-            GRBVar scalar;
-            std::vector<Node> children;
+    private:
+        /// Declaration data and storage of lazily materialized groups, shared by
+        /// copies so every copy sees one activation state and one set of columns
+        struct LazyState {
+            enum : unsigned char { Declared = 0, Pending = 1, Live = 2 };
 
-            Node() = default;
-            Node(const GRBVar& v) : scalar(v) {}
-            Node(size_t n) : children(n) {}
+            GRBModel* model = nullptr;
+            char vtype = GRB_CONTINUOUS;
+            double lb = 0.0, ub = 0.0;
+            std::string baseName;
+            std::vector<GRBVar> columns;        ///< Row-major handles (valid where Live)
+            std::vector<unsigned char> state;   ///< Declared / Pending / Live per element
+            std::vector<size_t> pending;        ///< Positions queued for batched activation
+            size_t live = 0;                    ///< Number of real solver columns
         };
 
-    private:
-        Node root;
-        int dims = 0;
+        std::vector<GRBVar> vars;         ///< Row-major element storage (eager groups)
+        FlatShape layout;                 ///< Extents and strides
+        std::shared_ptr<LazyState> lazyState; ///< Set only for lazy groups
 
     public:
-        VariableGroup() = default;
-        VariableGroup(Node&& r, int d) : root(std::move(r)), dims(d) {}
-        explicit VariableGroup(const GRBVar& v) : root(Node(v)), dims(0) {}
+        VariableGroup() : vars(1) {}
+        explicit VariableGroup(const GRBVar& v) : vars(1, v) {}
+
+        /// Wrap a row-major buffer with the given shape
+        VariableGroup(std::vector<GRBVar>&& data, std::vector<size_t> shape)
+            : vars(std::move(data)), layout(std::move(shape)) {
+            if (layout.size() != vars.size()) {
+                throw std::invalid_argument("VariableGroup: buffer size does not match shape");
+            }
+        }
 
-        int dimension() const { return dims; }
+        int dimension() const { return layout.rank(); }
 
-        /// Access element with bounds checking
+        /// Total number of elements
+        size_t size() const { return layout.size(); }
+
+        /// Size of dimension d
+        size_t extent(int d) const { return layout.extent(d); }
+
+        /// Sizes of all dimensions (empty for scalars)
+        const std::vector<size_t>& shape() const { return layout.dims(); }
+
+        /// Row-major layout
+        const FlatShape& flatShape() const { return layout; }
+
+        /// Contiguous row-major storage
+        GRBVar* data() { return store(); }
+        const GRBVar* data() const { return store(); }
+
+        GRBVar* begin() { return store(); }
+        GRBVar* end() { return store() + size(); }
+        const GRBVar* begin() const { return store(); }
+        const GRBVar* end() const { return store() + size(); }
+
+        /// Access element with bounds checking (materializes lazy elements)
         template<typename... Indices>
         GRBVar& at(Indices... idx) {
-            static_assert((std::is_integral_v<Indices> && ...), "Indices must be integral.");
-            if (static_cast<int>(sizeof...(idx)) != dims) {
-                throw std::runtime_error("VariableGroup::at(): wrong number of indices");
+            const size_t p = offset(idx...);
+            if (lazyState && lazyState->state[p] != LazyState::Live) {
+                activateAt(p);
+                materialize();
+            }
+            return store()[p];
+        }
+
+        template<typename... Indices>
+        const GRBVar& at(Indices... idx) const {
+            const size_t p = offset(idx...);
+            if (lazyState && lazyState->state[p] != LazyState::Live) {
+                throw std::logic_error("VariableGroup::at(): lazy element not materialized");
             }
-            return atRec(root, idx...);
+            return store()[p];
         }
 
         /// Access scalar variable
         GRBVar& scalar() {
-            if (dims != 0) throw std::runtime_error("VariableGroup::scalar() called on non-scalar");
-            return root.scalar;
+            if (layout.rank() != 0) throw std::runtime_error("VariableGroup::scalar() called on non-scalar");
+            return store()[0];
         }
 
         /// Operator() syntax for cleaner code
         template<typename... I> GRBVar& operator()(I... idx) { return at(idx...); }
+        template<typename... I> const GRBVar& operator()(I... idx) const { return at(idx...); }
+
+        /// Row-major flat offset of an element (bounds checked)
+        template<typename... Indices>
+        size_t offset(Indices... idx) const {
+            static_assert((std::is_integral_v<Indices> && ...), "Indices must be integral.");
+            if (static_cast<int>(sizeof...(idx)) != layout.rank()) {
+                throw std::runtime_error("VariableGroup::at(): wrong number of indices");
+            }
+            return layout.offset(idx...);
+        }
+
+        // ============================================================================
+        // LAZY MATERIALIZATION
+        // ============================================================================
+
+        /// True if elements become solver columns only on first use
+        bool isLazy() const { return lazyState != nullptr; }
+
+        /// Number of elements that are real solver columns
+        size_t materializedCount() const { return lazyState ? lazyState->live : size(); }
+
+        /// True if the element is a real solver column
+        template<typename... Indices>
+        bool isMaterialized(Indices... idx) const {
+            return !lazyState || lazyState->state[offset(idx...)] == LazyState::Live;
+        }
+
+        /// Queue an element for the next batched materialize() (no solver call)
+        template<typename... Indices>
+        void activate(Indices... idx) {
+            if (lazyState) activateAt(offset(idx...));
+        }
+
+        /// Create all queued elements with one addVars call; returns how many
+        size_t materialize() {
+            if (!lazyState || lazyState->pending.empty()) return 0;
+            requireSequential();
+            LazyState& lz = *lazyState;
+            const size_t n = lz.pending.size();
+
+            std::vector<std::string> names;
+            if constexpr (DEBUG_NAMES) {
+                names.reserve(n);
+                for (size_t p : lz.pending) names.push_back(naming::nameND(lz.baseName, layout.unravel(p)));
+            }
+            std::vector<double> lbs(n, lz.lb), ubs(n, lz.ub);
+            std::vector<char> types(n, lz.vtype);
+            std::unique_ptr<GRBVar[]> created(lz.model->addVars(lbs.data(), ubs.data(), nullptr,
+                types.data(), names.empty() ? nullptr : names.data(), static_cast<int>(n)));
+
+            for (size_t k = 0; k < n; ++k) {
+                lz.columns[lz.pending[k]] = created[k];
+                lz.state[lz.pending[k]] = LazyState::Live;
+            }
+            lz.live += n;
+            lz.pending.clear();
+            return n;
+        }
+
+        /// Zero-copy view: integral arguments fix a dimension, `all` keeps it.
+        /// slice() with no arguments views the whole group. Lazy elements in
+        /// the view are materialized (in one batch) before it is returned.
+        template<typename... Args>
+        VariableSlice slice(Args... args) {
+            VariableSlice view = sliceView(args...);
+            if (lazyState) {
+                view.forEachVar([&](const GRBVar& v) { activateAt(static_cast<size_t>(&v - store())); });
+                materialize();
+            }
+            return view;
+        }
+
+        // ============================================================================
+        // BULK ATTRIBUTE ACCESS
+        // ============================================================================
+
+        /// Attribute values (solution X by default) of the whole group in one query.
+        /// Lazy elements that were never materialized read as 0.
+        ValueArray values(GRBModel& model, GRB_DoubleAttr attr = GRB_DoubleAttr_X) const {
+            return ValueArray(readRange(model, attr, 0, size()), layout);
+        }
+
+        /// Attribute values of the contiguous block X(lead..., :, ..., :) in one query
+        template<typename... Leading>
+        ValueArray sliceValues(GRBModel& model, GRB_DoubleAttr attr, Leading... lead) const {
+            const size_t begin = layout.blockOffset(lead...);
+            FlatShape block = layout.trailing(sizeof...(lead));
+            return ValueArray(readRange(model, attr, begin, block.size()), std::move(block));
+        }
+
+        /// Set an attribute (Start, LB, UB, Obj, VarHintVal, ...) from a row-major array.
+        /// Lazy elements that were never materialized are skipped.
+        void setValues(GRBModel& model, GRB_DoubleAttr attr, std::span<const double> values) {
+            if (values.size() != size()) {
+                throw std::invalid_argument("VariableGroup::setValues(): value count does not match group size");
+            }
+            writeRange(model, attr, values.data(), 0, size());
+        }
+
+        /// Set the same attribute value on every element
+        void fill(GRBModel& model, GRB_DoubleAttr attr, double value) {
+            std::vector<double> buf(size(), value);
+            writeRange(model, attr, buf.data(), 0, buf.size());
+        }
+
+        /// Set an attribute to gen(i, j, ...) for every index tuple of the ranges
+        template<typename F, typename Range, typename... Rest>
+        void setValues(GRBModel& model, GRB_DoubleAttr attr, F&& gen, const Range& first, const Rest&... rest) {
+            const size_t n = static_cast<size_t>(first.size()) * (static_cast<size_t>(rest.size()) * ... * 1);
+            std::vector<GRBVar> targets;
+            std::vector<double> buf;
+            targets.reserve(n);
+            buf.reserve(n);
+            dsl::forEach([&](auto... idx) {
+                const size_t p = offset(idx...);
+                if (lazyState && lazyState->state[p] != LazyState::Live) return;
+                targets.push_back(store()[p]);
+                buf.push_back(gen(idx...));
+                }, first, rest...);
+            attr::set(model, attr, targets.data(), buf.data(), buf.size());
+        }
 
     private:
-        // Base case: return scalar variable
-        GRBVar& atRec(Node& n) { return n.scalar; }
+        // Lazy group: every element declared, none materialized
+        VariableGroup(GRBModel& model, char vtype, double lb, double ub,
+            const std::string& baseName, std::vector<size_t> shape)
+            : layout(std::move(shape)), lazyState(std::make_shared<LazyState>()) {
+            LazyState& lz = *lazyState;
+            lz.model = &model;
+            lz.vtype = vtype;
+            lz.lb = lb;
+            lz.ub = ub;
+            lz.baseName = baseName;
+            lz.columns.resize(layout.size());
+            lz.state.assign(layout.size(), LazyState::Declared);
+        }
+
+        GRBVar* store() { return lazyState ? lazyState->columns.data() : vars.data(); }
+        const GRBVar* store() const { return lazyState ? lazyState->columns.data() : vars.data(); }
+
+        void activateAt(size_t p) {
+            if (lazyState->state[p] != LazyState::Declared) return;
+            requireSequential();
+            lazyState->state[p] = LazyState::Pending;
+            lazyState->pending.push_back(p);
+        }
+
+        // Lazy state and the model are not thread-safe: refuse changes from a parallel pass
+        static void requireSequential() {
+            if (dsl::detail::parallelSection) {
+                throw std::logic_error("VariableGroup: lazy elements must be materialized before a parallel pass");
+            }
+        }
+
+        // Read [first, first + n); unmaterialized lazy elements read as 0
+        std::vector<double> readRange(GRBModel& model, GRB_DoubleAttr attr, size_t first, size_t n) const {
+            if (!lazyState || lazyState->live == size()) {
+                return attr::get(model, attr, store() + first, n);
+            }
+            std::vector<GRBVar> live;
+            std::vector<size_t> pos;
+            for (size_t p = first; p < first + n; ++p) {
+                if (lazyState->state[p] != LazyState::Live) continue;
+                live.push_back(store()[p]);
+                pos.push_back(p - first);
+            }
+            std::vector<double> got = attr::get(model, attr, live.data(), live.size());
+            std::vector<double> out(n, 0.0);
+            for (size_t k = 0; k < pos.size(); ++k) out[pos[k]] = got[k];
+            return out;
+        }
 
-        // Recursive case: traverse children
-        template<typename First, typename... Rest>
-        GRBVar& atRec(Node& n, First i, Rest... rest) {
-            if (i < 0 || static_cast<size_t>(i) >= n.children.size()) {
-                throw std::out_of_range("VariableGroup index out of range");
+        // Write [first, first + n); unmaterialized lazy elements are skipped
+        void writeRange(GRBModel& model, GRB_DoubleAttr attr, const double* values, size_t first, size_t n) {
+            if (!lazyState || lazyState->live == size()) {
+                attr::set(model, attr, store() + first, values, n);
+                return;
+            }
+            std::vector<GRBVar> live;
+            std::vector<double> vals;
+            for (size_t p = first; p < first + n; ++p) {
+                if (lazyState->state[p] != LazyState::Live) continue;
+                live.push_back(store()[p]);
+                vals.push_back(values[p - first]);
+            }
+            attr::set(model, attr, live.data(), vals.data(), live.size());
+        }
+
+        template<typename... Args>
+        VariableSlice sliceView(Args... args) {
+            constexpr size_t count = sizeof...(args);
+            if (count != 0 && static_cast<int>(count) != layout.rank()) {
+                throw std::runtime_error("VariableGroup::slice(): wrong number of indices");
+            }
+            if constexpr (count == 0) {
+                std::vector<size_t> strides(layout.dims().size());
+                for (int d = 0; d < layout.rank(); ++d) strides[static_cast<size_t>(d)] = layout.stride(d);
+                return VariableSlice(store(), layout.dims(), std::move(strides));
+            }
+            else {
+                size_t first = 0;
+                int d = 0;
+                std::vector<size_t> extents, strides;
+                auto select = [&](auto a) {
+                    if constexpr (std::is_same_v<decltype(a), All>) {
+                        extents.push_back(layout.extent(d));
+                        strides.push_back(layout.stride(d));
+                    }
+                    else {
+                        static_assert(std::is_integral_v<decltype(a)>, "slice() takes indices or mini::all");
+                        if (std::cmp_less(a, 0) || std::cmp_greater_equal(a, layout.extent(d))) {
+                            throw std::out_of_range("VariableGroup index out of range");
+                        }
+                        first += static_cast<size_t>(a) * layout.stride(d);
+                    }
+                    ++d;
+                };
+                (select(args), ...);
+                return VariableSlice(store() + first, std::move(extents), std::move(strides));
             }
-            return atRec(n.children[static_cast<size_t>(i)], rest...);
         }
 
         friend class VariableFactory;
     };
 
-} // namespace mini
\ No newline at end of file
+} // namespace mini
@@ -0,0 +1,115 @@
+#pragma once
+/*
+VariableGroupN.h
+Rank-typed view over a VariableGroup with compile-time index checking.
+
+Features:
+- Number of indices checked at compile time (no runtime dims test)
+- Extents and strides held in std::array (no heap indirection)
+- Opt-in unchecked access for release-build hot loops
+
+Examples:
+  VariableGroup X = VariableFactory::add(model, GRB_BINARY, 0, 1, "X", 10, 20, 30);
+
+  VariableGroupN<3> x(X);           // rank verified once, here
+  model.addConstr(x(i, j, k) <= 1);   // bounds checked
+  x(i, j);                            // compile error: wrong number of indices
+
+  // Hot loop: bounds only asserted in debug builds
+  GRBLinExpr e = sum([&](int i, int j, int k) { return x.atUnchecked(i, j, k); }, I, J, K);
+
+  // From a table
+  auto y = vars.get<2>(Vars::Y);
+*/
+
+#include <array>
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+#include "gurobi_c++.h"
+#include "VariableGroup.h"
+
+namespace mini {
+
+    template<size_t R>
+    class VariableGroupN {
+        GRBVar* vars = nullptr;                 ///< Row-major storage of the viewed group
+        std::array<size_t, R> extents{};        ///< Size of each dimension
+        std::array<size_t, R> strides{};        ///< Row-major stride of each dimension
+
+    public:
+        VariableGroupN() = default;
+
+        /// View a group of rank R (throws if the rank differs)
+        explicit VariableGroupN(VariableGroup& group) : vars(group.data()) {
+            if (group.dimension() != static_cast<int>(R)) {
+                throw std::runtime_error("VariableGroupN: group rank does not match");
+            }
+            if (group.materializedCount() != group.size()) {
+                throw std::logic_error("VariableGroupN: lazy group is not fully materialized");
+            }
+            size_t stride = 1;
+            for (size_t d = R; d-- > 0;) {
+                extents[d] = group.extent(static_cast<int>(d));
+                strides[d] = stride;
+                stride *= extents[d];
+            }
+        }
+
+        static constexpr int dimension() { return static_cast<int>(R); }
+
+        /// Total number of elements
+        size_t size() const {
+            size_t total = 1;
+            for (size_t n : extents) total *= n;
+            return total;
+        }
+
+        /// Size of dimension d
+        size_t extent(int d) const { return extents[static_cast<size_t>(d)]; }
+
+        /// Contiguous row-major storage
+        GRBVar* data() const { return vars; }
+
+        GRBVar* begin() const { return vars; }
+        GRBVar* end() const { return vars + size(); }
+
+        /// Access element with bounds checking
+        template<typename... Indices>
+        GRBVar& at(Indices... idx) const {
+            checkArity<Indices...>();
+            size_t off = 0, d = 0;
+            ((off += strides[d] * checkedIndex(idx, extents[d]), ++d), ...);
+            return vars[off];
+        }
+
+        /// Access element without bounds checking (asserted in debug builds)
+        template<typename... Indices>
+        GRBVar& atUnchecked(Indices... idx) const {
+            checkArity<Indices...>();
+            size_t off = 0, d = 0;
+            ((assert(static_cast<size_t>(idx) < extents[d]), off += strides[d] * static_cast<size_t>(idx), ++d), ...);
+            return vars[off];
+        }
+
+        /// Operator() syntax for cleaner code
+        template<typename... I> GRBVar& operator()(I... idx) const { return at(idx...); }
+
+    private:
+        template<typename... Indices>
+        static constexpr void checkArity() {
+            static_assert(sizeof...(Indices) == R, "VariableGroupN: wrong number of indices");
+            static_assert((std::is_integral_v<Indices> && ...), "Indices must be integral.");
+        }
+
+        template<typename I>
+        static size_t checkedIndex(I i, size_t n) {
+            if constexpr (std::is_signed_v<I>) {
+                if (i < 0) throw std::out_of_range("VariableGroupN index out of range");
+            }
+            if (static_cast<size_t>(i) >= n) throw std::out_of_range("VariableGroupN index out of range");
+            return static_cast<size_t>(i);
+        }
+    };
+
+} // namespace mini
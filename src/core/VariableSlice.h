@@ -0,0 +1,190 @@
+#pragma once
+/*
+VariableSlice.h
+Zero-copy strided view over part of a VariableGroup.
+
+Features:
+- x.slice(i, all, k) references the group's storage without copying
+- Knows its own extents; indexed with the free dimensions only
+- Accepted directly by dsl::sum, atMostOne and exactlyOne
+- Bulk attribute get/set with one array call per slice
+
+Examples:
+  VariableGroup X = VariableFactory::add(model, GRB_BINARY, 0, 1, "X", 10, 20, 30);
+
+  auto row = X.slice(i, all, k);       // 1-D view over j
+  GRBVar& v = row(j);                  // same as X(i, j, k)
+
+  GRBLinExpr load = sum(row);          // one batched addTerms call
+  exactlyOne(model, X.slice(i, all, all), "assign");
+
+  ValueArray xi = X.slice(i, all, all).values(model);
+*/
+
+#include <span>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+#include "gurobi_c++.h"
+#include "../indexing/Indexing.h"
+#include "ValueArray.h"
+#include "Attributes.h"
+
+namespace mini {
+
+    /// Placeholder selecting a whole dimension in slice()
+    struct All {};
+    inline constexpr All all{};
+
+    class VariableSlice {
+        GRBVar* base = nullptr;           ///< First element of the view
+        std::vector<size_t> extents;      ///< Size of each free dimension
+        std::vector<size_t> strides;      ///< Stride of each free dimension in the parent
+
+    public:
+        VariableSlice() = default;
+        VariableSlice(GRBVar* first, std::vector<size_t> ext, std::vector<size_t> str)
+            : base(first), extents(std::move(ext)), strides(std::move(str)) {
+        }
+
+        int dimension() const { return static_cast<int>(extents.size()); }
+
+        /// Number of elements in the view
+        size_t size() const {
+            size_t total = 1;
+            for (size_t n : extents) total *= n;
+            return total;
+        }
+
+        size_t extent(int d) const { return extents.at(static_cast<size_t>(d)); }
+        const std::vector<size_t>& shape() const { return extents; }
+
+        /// True if the view is one contiguous run of the parent's storage
+        bool contiguous() const {
+            size_t expected = 1;
+            for (size_t d = extents.size(); d-- > 0;) {
+                if (extents[d] > 1 && strides[d] != expected) return false;
+                expected *= extents[d];
+            }
+            return true;
+        }
+
+        /// Access element by free-dimension indices (bounds checked)
+        template<typename... Indices>
+        GRBVar& operator()(Indices... idx) const {
+            static_assert((std::is_integral_v<Indices> && ...), "Indices must be integral.");
+            if (sizeof...(idx) != extents.size()) {
+                throw std::runtime_error("VariableSlice: wrong number of indices");
+            }
+            size_t off = 0, d = 0;
+            ((off += strides[d] * checkedIndex(idx, extents[d]), ++d), ...);
+            return base[off];
+        }
+
+        /// Visit every element in row-major order of the view
+        template<typename Fn>
+        void forEachVar(Fn&& fn) const {
+            const size_t n = size();
+            if (n == 0) return;
+            if (contiguous()) {
+                for (size_t p = 0; p < n; ++p) fn(base[p]);
+                return;
+            }
+            std::vector<size_t> idx(extents.size(), 0);
+            size_t off = 0;
+            for (size_t p = 0; p < n; ++p) {
+                fn(base[off]);
+                for (size_t d = idx.size(); d-- > 0;) {
+                    off += strides[d];
+                    if (++idx[d] < extents[d]) break;
+                    off -= strides[d] * extents[d];
+                    idx[d] = 0;
+                }
+            }
+        }
+
+        /// Copy the viewed handles into a contiguous buffer
+        std::vector<GRBVar> gather() const {
+            std::vector<GRBVar> out;
+            out.reserve(size());
+            forEachVar([&](const GRBVar& v) { out.push_back(v); });
+            return out;
+        }
+
+        /// Sum of the viewed variables, built with one addTerms call
+        GRBLinExpr linExpr() const {
+            std::vector<GRBVar> vs = gather();
+            std::vector<double> ones(vs.size(), 1.0);
+            GRBLinExpr e = 0;
+            if (!vs.empty()) e.addTerms(ones.data(), vs.data(), static_cast<int>(vs.size()));
+            return e;
+        }
+
+        /// Weighted sum coeffs[p] * var[p] (row-major order of the view)
+        GRBLinExpr linExpr(std::span<const double> coeffs) const {
+            std::vector<GRBVar> vs = gather();
+            if (coeffs.size() != vs.size()) {
+                throw std::invalid_argument("VariableSlice::linExpr(): coefficient count does not match slice size");
+            }
+            GRBLinExpr e = 0;
+            if (!vs.empty()) e.addTerms(coeffs.data(), vs.data(), static_cast<int>(vs.size()));
+            return e;
+        }
+
+        // ============================================================================
+        // BULK ATTRIBUTE ACCESS
+        // ============================================================================
+
+        /// Attribute values (solution X by default) of the view in one query
+        ValueArray values(GRBModel& model, GRB_DoubleAttr attr = GRB_DoubleAttr_X) const {
+            FlatShape shape(extents);
+            if (contiguous()) return ValueArray(attr::get(model, attr, base, size()), std::move(shape));
+            std::vector<GRBVar> vs = gather();
+            return ValueArray(attr::get(model, attr, vs.data(), vs.size()), std::move(shape));
+        }
+
+        /// Set an attribute from a row-major array matching the view, one call
+        void setValues(GRBModel& model, GRB_DoubleAttr attr, std::span<const double> values) const {
+            if (values.size() != size()) {
+                throw std::invalid_argument("VariableSlice::setValues(): value count does not match slice size");
+            }
+            if (contiguous()) {
+                attr::set(model, attr, base, values.data(), values.size());
+                return;
+            }
+            std::vector<GRBVar> vs = gather();
+            attr::set(model, attr, vs.data(), values.data(), vs.size());
+        }
+
+        /// Set the same attribute value on every viewed element
+        void fill(GRBModel& model, GRB_DoubleAttr attr, double value) const {
+            std::vector<double> buf(size(), value);
+            setValues(model, attr, buf);
+        }
+
+    private:
+        template<typename I>
+        static size_t checkedIndex(I i, size_t n) {
+            if constexpr (std::is_signed_v<I>) {
+                if (i < 0) throw std::out_of_range("VariableSlice index out of range");
+            }
+            if (static_cast<size_t>(i) >= n) throw std::out_of_range("VariableSlice index out of range");
+            return static_cast<size_t>(i);
+        }
+    };
+
+} // namespace mini
+
+namespace mini::dsl {
+
+    template<> struct is_var_view<VariableSlice> : std::true_type {};
+
+    /// Sum of every variable in a slice (one batched term insertion)
+    inline GRBLinExpr sum(const VariableSlice& view) { return view.linExpr(); }
+
+    /// Weighted sum over a slice: coeffs in row-major order of the view
+    inline GRBLinExpr sum(const VariableSlice& view, std::span<const double> coeffs) {
+        return view.linExpr(coeffs);
+    }
+
+} // namespace mini::dsl
@@ -7,6 +7,10 @@ Features:
 - Compile-time sized table
 - Type-safe enum access
 - Clean syntax for variable retrieval
+- Rank-typed views via get<R>(key) (rank checked when the view is built)
+- Opt-in rankOf<Key> trait: get<Key>() then rejects mismatched index
+  counts at compile time
+- Materialization counts for lazy groups
 
 Examples:
   enum class Vars { X, Y, Z, COUNT };
@@ -18,36 +22,86 @@ Examples:
   // Access variables
   GRBVar& x_ij = vars.var(Vars::X, i, j);
   GRBVar& y = vars.var(Vars::Y);  // scalar
+
+  // Rank-typed access (stored rank checked at runtime, throws on mismatch;
+  // index count of x(...) checked at compile time)
+  auto x = vars.get<2>(Vars::X);
+  GRBVar& x_ij2 = x(i, j);
+
+  // Declared ranks: the rank comes from the key, so a wrong index count at
+  // any call site is a compile error
+  template<> inline constexpr int mini::rankOf<Vars::X> = 2;
+  auto x2 = vars.get<Vars::X>();
+  x2(i, j, k);                       // compile error
+  vars.get<Vars::Y>();               // compile error: rankOf<Vars::Y> not declared
 */
 
 #include <array>
 #include "VariableGroup.h"
+#include "VariableGroupN.h"
 
 namespace mini {
 
+    /// Declared rank of a table key; specialize per key to enable get<Key>()
+    template<auto Key>
+    inline constexpr int rankOf = -1;
+
     template<typename EnumT, size_t MAX>
     class VariableTable {
         std::array<VariableGroup, MAX> table;
+        std::array<bool, MAX> stored{};     ///< Slots filled through set()
 
     public:
         /// Store variable group
         void set(EnumT key, VariableGroup&& group) {
             table[static_cast<size_t>(key)] = std::move(group);
+            stored[static_cast<size_t>(key)] = true;
         }
 
         /// Store scalar GRBVar (const lvalue)
         void set(EnumT key, const GRBVar& var) {
             table[static_cast<size_t>(key)] = VariableGroup(var);
+            stored[static_cast<size_t>(key)] = true;
         }
 
         /// Store scalar GRBVar (rvalue)
         void set(EnumT key, GRBVar&& var) {
             table[static_cast<size_t>(key)] = VariableGroup(var);
+            stored[static_cast<size_t>(key)] = true;
         }
 
         /// Get variable group reference
         VariableGroup& get(EnumT key) { return table[static_cast<size_t>(key)]; }
 
+        /// Get rank-typed view of a group (throws if the stored rank is not R)
+        template<size_t R>
+        VariableGroupN<R> get(EnumT key) { return VariableGroupN<R>(get(key)); }
+
+        /// Get rank-typed view with the rank taken from rankOf<Key>; the
+        /// stored group is still checked against it when the view is built
+        template<EnumT Key, size_t R = static_cast<size_t>(rankOf<Key> < 0 ? 0 : rankOf<Key>)>
+        VariableGroupN<R> get() {
+            static_assert(rankOf<Key> >= 0, "VariableTable::get<Key>(): specialize mini::rankOf<Key> first");
+            static_assert(rankOf<Key> < 0 || R == static_cast<size_t>(rankOf<Key>), "VariableTable::get<Key>(): rank is set by rankOf<Key>");
+            return VariableGroupN<R>(get(Key));
+        }
+
+        /// Number of real solver columns in a group (less than its size for
+        /// lazy groups, 0 for a key never set)
+        size_t materialized(EnumT key) const {
+            const size_t k = static_cast<size_t>(key);
+            return stored[k] ? table[k].materializedCount() : 0;
+        }
+
+        /// Number of real solver columns across all set groups
+        size_t materialized() const {
+            size_t total = 0;
+            for (size_t k = 0; k < MAX; ++k) {
+                if (stored[k]) total += table[k].materializedCount();
+            }
+            return total;
+        }
+
         /// Operator() syntax for group access
         VariableGroup& operator()(EnumT key) { return get(key); }
 
@@ -6,8 +6,14 @@ High-performance indexing and iteration system with recursive variadic templates
 Features:
 - Zero-overhead range views (no memory allocation)
 - Recursive variadic summation for any number of dimensions
+- Summation appends into preallocated term buffers and builds the
+  expression with a single addTerms call
 - Compile-time optimized loops
 - Uniform API for 1D, 2D, 3D, ... ND operations
+- Tuple domains (sparse / ragged domain(), or tuples(range)) expand each
+  element into several indices
+- Any other range passes its elements through whole, tuple-valued or not
+  (e.g. label lists of pairs)
 
 Examples:
   // Create index ranges
@@ -19,6 +25,14 @@ Examples:
       return cost(i,j,k) * x(i,j,k);
   }, I, J, K);
 
+  // Allocation-free terms (no GRBLinExpr temporary per element)
+  GRBLinExpr obj = sum([&](int i, int j) { return term(cost(i,j), x(i,j)); }, I, J);
+
+  // A list of (i,j) pairs as two indices, or as one pair-valued index
+  std::vector<std::array<int, 2>> arcs = ...;
+  GRBLinExpr flow = sum([&](int i, int j) { return x(i,j); }, tuples(arcs));
+  GRBLinExpr same = sum([&](const std::array<int, 2>& a) { return x(a[0], a[1]); }, arcs);
+
   // Constraint building
   forall([&](int i, int j) {
       model.addConstr(x(i,j) <= capacity(i));
@@ -27,6 +41,8 @@ Examples:
 
 #include <vector>
 #include <tuple>
+#include <iterator>
+#include <type_traits>
 #include "gurobi_c++.h"
 
 namespace mini::dsl {
@@ -61,6 +77,40 @@ namespace mini::dsl {
     /// Create range [start, end) without allocation  
     inline RangeView range(int start, int end) { return RangeView(start, end); }
 
+    /// True for tuple-like range elements (std::array, std::pair, std::tuple)
+    template<typename T>
+    inline constexpr bool is_tuple_like_v = requires { std::tuple_size<T>::value; };
+
+    /// Opt-in trait for ranges whose tuple-like elements are expanded into
+    /// several indices (sparse / ragged domains); elements of other ranges
+    /// reach the lambda as one argument
+    template<typename T>
+    struct is_tuple_domain : std::false_type {};
+
+    template<typename T>
+    inline constexpr bool is_tuple_domain_v = is_tuple_domain<std::remove_cvref_t<T>>::value;
+
+    /// View of a range of tuples iterated as a tuple domain (the range must
+    /// outlive the view)
+    template<typename Range>
+    class TupleDomain {
+        const Range* range_;
+    public:
+        explicit TupleDomain(const Range& range) : range_(&range) {}
+
+        auto begin() const { return std::begin(*range_); }
+        auto end() const { return std::end(*range_); }
+        size_t size() const { return static_cast<size_t>(std::size(*range_)); }
+        decltype(auto) operator[](size_t p) const { return (*range_)[p]; }
+    };
+
+    template<typename Range>
+    struct is_tuple_domain<TupleDomain<Range>> : std::true_type {};
+
+    /// Iterate a range of tuples as several indices per element
+    template<typename Range>
+    TupleDomain<Range> tuples(const Range& range) { return TupleDomain<Range>(range); }
+
     // ============================================================================
     // RECURSIVE VARIADIC SUMMATION
     // ============================================================================
@@ -71,6 +121,62 @@ namespace mini::dsl {
     inline GRBLinExpr toExpr(double d) { GRBLinExpr e = 0; e += d; return e; }
     inline GRBLinExpr toExpr(int i) { return toExpr(static_cast<double>(i)); }
 
+    /// Single coefficient * variable term (no GRBLinExpr temporary)
+    struct Term {
+        double coeff;
+        GRBVar var;
+    };
+
+    /// Build a term: sum([&](int i) { return term(cost[i], x(i)); }, I)
+    inline Term term(double coeff, const GRBVar& var) { return Term{ coeff, var }; }
+
+    /// Number of index tuples a range yields (0 if it cannot tell)
+    template<typename Range>
+    size_t rangeSize(const Range& r) {
+        if constexpr (requires { r.size(); }) return static_cast<size_t>(r.size());
+        else return 0;
+    }
+
+    /// Contiguous (coefficient, variable, constant) buffers turned into a
+    /// GRBLinExpr with one addTerms call
+    class LinearAccumulator {
+        std::vector<double> coeffs;
+        std::vector<GRBVar> vars;
+        double constant = 0.0;
+
+    public:
+        void reserve(size_t n) { coeffs.reserve(n); vars.reserve(n); }
+        size_t size() const { return vars.size(); }
+        void clear() { coeffs.clear(); vars.clear(); constant = 0.0; }
+
+        void add(const GRBVar& v) { coeffs.push_back(1.0); vars.push_back(v); }
+        void add(const Term& t) { coeffs.push_back(t.coeff); vars.push_back(t.var); }
+        void add(double d) { constant += d; }
+        void add(int i) { constant += i; }
+        void add(const GRBLinExpr& e) {
+            const unsigned n = e.size();
+            for (unsigned k = 0; k < n; ++k) {
+                coeffs.push_back(e.getCoeff(k));
+                vars.push_back(e.getVar(k));
+            }
+            constant += e.getConstant();
+        }
+
+        /// Append another accumulator's terms after this one's
+        void append(const LinearAccumulator& other) {
+            coeffs.insert(coeffs.end(), other.coeffs.begin(), other.coeffs.end());
+            vars.insert(vars.end(), other.vars.begin(), other.vars.end());
+            constant += other.constant;
+        }
+
+        /// Build the expression with a single addTerms call
+        GRBLinExpr build() const {
+            GRBLinExpr e = constant;
+            if (!vars.empty()) e.addTerms(coeffs.data(), vars.data(), static_cast<int>(vars.size()));
+            return e;
+        }
+    };
+
     /// Recursive variadic nested-loop helper for summation
     template<typename F, typename... Ranges>
     struct SumLoop;
@@ -79,9 +185,18 @@ namespace mini::dsl {
     template<typename F, typename Range, typename... Rest>
     struct SumLoop<F, Range, Rest...> {
         template<typename... Idxs>
-        static void run(GRBLinExpr& total, F& f, const Range& range, const Rest&... rest, Idxs... idxs) {
-            for (auto i : range) {
-                SumLoop<F, Rest...>::run(total, f, rest..., idxs..., i);
+        static void run(LinearAccumulator& total, F& f, const Range& range, const Rest&... rest, const Idxs&... idxs) {
+            for (const auto& i : range) {
+                if constexpr (!is_tuple_domain_v<Range>) {
+                    SumLoop<F, Rest...>::run(total, f, rest..., idxs..., i);
+                }
+                else {
+                    // Tuple domain (e.g. a sparse domain): expand into several indices
+                    static_assert(is_tuple_like_v<std::decay_t<decltype(i)>>, "tuple domain elements must be tuple-like");
+                    std::apply([&](auto... js) {
+                        SumLoop<F, Rest...>::run(total, f, rest..., idxs..., js...);
+                        }, i);
+                }
             }
         }
     };
@@ -90,17 +205,43 @@ namespace mini::dsl {
     template<typename F>
     struct SumLoop<F> {
         template<typename... Idxs>
-        static void run(GRBLinExpr& total, F& f, Idxs... idxs) {
-            total += toExpr(f(idxs...));
+        static void run(LinearAccumulator& total, F& f, const Idxs&... idxs) {
+            total.add(f(idxs...));
         }
     };
 
+    /// Opt-in trait for variable views that sum() and the cardinality
+    /// builders accept directly instead of a lambda (e.g. VariableSlice)
+    template<typename T>
+    struct is_var_view : std::false_type {};
+
+    template<typename T>
+    inline constexpr bool is_var_view_v = is_var_view<std::remove_cvref_t<T>>::value;
+
+    namespace detail {
+
+        /// True on a thread while it runs part of a parallel pass (see
+        /// Parallel.h); used to refuse model calls that are not thread-safe
+        inline thread_local bool parallelSection = false;
+
+    } // namespace detail
+
+    /// Opt-in trait for execution policies taken as the first argument of
+    /// the parallel overloads (see Parallel.h)
+    template<typename T>
+    struct is_execution_policy : std::false_type {};
+
+    template<typename T>
+    inline constexpr bool is_execution_policy_v = is_execution_policy<std::remove_cvref_t<T>>::value;
+
     /// Main summation function: sum over multiple ranges
     template<typename F, typename... Ranges>
+        requires (!is_var_view_v<F> && !is_execution_policy_v<F>)
     GRBLinExpr sum(F&& f, Ranges&&... ranges) {
-        GRBLinExpr total = 0;
+        LinearAccumulator total;
+        total.reserve((rangeSize(ranges) * ... * size_t{ 1 }));
         SumLoop<F, Ranges...>::run(total, f, ranges...);
-        return total;
+        return total.build();
     }
 
     // ============================================================================
@@ -115,9 +256,17 @@ namespace mini::dsl {
     template<typename F, typename Range, typename... Rest>
     struct ForEachLoop<F, Range, Rest...> {
         template<typename... Idxs>
-        static void run(F& f, const Range& range, const Rest&... rest, Idxs... idxs) {
-            for (auto i : range) {
-                ForEachLoop<F, Rest...>::run(f, rest..., idxs..., i);
+        static void run(F& f, const Range& range, const Rest&... rest, const Idxs&... idxs) {
+            for (const auto& i : range) {
+                if constexpr (!is_tuple_domain_v<Range>) {
+                    ForEachLoop<F, Rest...>::run(f, rest..., idxs..., i);
+                }
+                else {
+                    static_assert(is_tuple_like_v<std::decay_t<decltype(i)>>, "tuple domain elements must be tuple-like");
+                    std::apply([&](auto... js) {
+                        ForEachLoop<F, Rest...>::run(f, rest..., idxs..., js...);
+                        }, i);
+                }
             }
         }
     };
@@ -126,13 +275,14 @@ namespace mini::dsl {
     template<typename F>
     struct ForEachLoop<F> {
         template<typename... Idxs>
-        static void run(F& f, Idxs... idxs) {
+        static void run(F& f, const Idxs&... idxs) {
             f(idxs...);
         }
     };
 
     /// Main iteration function: execute function over multiple ranges
     template<typename F, typename... Ranges>
+        requires (!is_execution_policy_v<F>)
     void forEach(F&& f, Ranges&&... ranges) {
         ForEachLoop<F, Ranges...>::run(f, ranges...);
     }
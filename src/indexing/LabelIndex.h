@@ -0,0 +1,173 @@
+#pragma once
+/*
+LabelIndex.h
+Static perfect-hash index from arbitrary labels to dense positions 0..n-1.
+
+Features:
+- Built once (hash-and-displace); lookups are one hash, two array reads
+  and one comparison, with no allocation
+- Labels: strings (looked up via std::string_view), integers / 64-bit IDs,
+  pairs and small tuples of those, or anything with std::hash
+- Unknown labels are detected (find() returns -1)
+
+Examples:
+  LabelIndex<std::string> skus({"A-100", "B-200", "C-300"});
+  long p = skus.find("B-200");          // 1, no std::string temporary
+  size_t q = skus.position("C-300");    // 2 (throws std::out_of_range if absent)
+
+  LabelIndex<std::pair<int, int>> arcs(arcList);
+*/
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <tuple>
+#include <cstdint>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace mini::dsl {
+
+    template<typename Label>
+    class LabelIndex {
+    public:
+        /// Type accepted by lookups (string labels are looked up by view)
+        using Lookup = std::conditional_t<std::is_same_v<Label, std::string>, std::string_view, Label>;
+
+    private:
+        std::vector<Label> labels;          ///< Position -> label
+        std::vector<uint32_t> seeds;        ///< Displacement seed per bucket
+        std::vector<int32_t> slots;         ///< Slot -> position (-1 = empty)
+
+    public:
+        LabelIndex() = default;
+
+        /// Build the index; positions follow the order of `ls` (labels must be unique)
+        explicit LabelIndex(std::vector<Label> ls) : labels(std::move(ls)) { build(); }
+
+        size_t size() const { return labels.size(); }
+        const Label& label(size_t pos) const { return labels.at(pos); }
+        const std::vector<Label>& all() const { return labels; }
+
+        /// Position of a label, or -1 if unknown
+        long find(const Lookup& key) const {
+            if (labels.empty()) return -1;
+            const uint64_t h = baseHash(key);
+            const uint32_t seed = seeds[mix(h) % seeds.size()];
+            const int32_t p = slots[slotHash(h, seed) % slots.size()];
+            return (p >= 0 && labels[static_cast<size_t>(p)] == key) ? p : -1;
+        }
+
+        bool contains(const Lookup& key) const { return find(key) >= 0; }
+
+        /// Position of a label (throws if unknown)
+        size_t position(const Lookup& key) const {
+            const long p = find(key);
+            if (p < 0) throw std::out_of_range("LabelIndex: unknown label");
+            return static_cast<size_t>(p);
+        }
+
+    private:
+        // splitmix64 finalizer
+        static uint64_t mix(uint64_t h) {
+            h ^= h >> 30; h *= 0xBF58476D1CE4E5B9ull;
+            h ^= h >> 27; h *= 0x94D049BB133111EBull;
+            return h ^ (h >> 31);
+        }
+
+        static uint64_t slotHash(uint64_t h, uint32_t seed) {
+            return mix(h ^ ((static_cast<uint64_t>(seed) + 1) * 0x9E3779B97F4A7C15ull));
+        }
+
+        template<typename T>
+        static uint64_t hashPart(const T& v) {
+            if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+                return mix(static_cast<uint64_t>(v));
+            }
+            else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+                return std::hash<std::string_view>{}(std::string_view(v));
+            }
+            else if constexpr (requires { std::tuple_size<T>::value; }) {
+                return std::apply([](const auto&... parts) {
+                    uint64_t h = 0;
+                    ((h = mix(h ^ hashPart(parts))), ...);
+                    return h;
+                    }, v);
+            }
+            else {
+                return std::hash<T>{}(v);
+            }
+        }
+
+        static uint64_t baseHash(const Lookup& key) { return hashPart(key); }
+
+        void build() {
+            const size_t n = labels.size();
+            if (n == 0) return;
+            if (n > static_cast<size_t>(INT32_MAX)) throw std::length_error("LabelIndex: too many labels");
+
+            std::vector<uint64_t> hashes(n);
+            for (size_t p = 0; p < n; ++p) hashes[p] = baseHash(labels[p]);
+
+            // Equal base hashes can never be separated: report duplicates/collisions
+            std::vector<size_t> order(n);
+            std::iota(order.begin(), order.end(), size_t{ 0 });
+            std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return hashes[a] < hashes[b]; });
+            for (size_t k = 1; k < n; ++k) {
+                if (hashes[order[k]] != hashes[order[k - 1]]) continue;
+                if (labels[order[k]] == labels[order[k - 1]]) throw std::invalid_argument("LabelIndex: duplicate label");
+                throw std::runtime_error("LabelIndex: hash collision between distinct labels");
+            }
+
+            size_t slotCount = n + n / 4 + 1;
+            for (int attempt = 0; attempt < 16; ++attempt, slotCount += slotCount / 2) {
+                if (tryPlace(hashes, (n + 1) / 2, slotCount)) return;
+            }
+            throw std::runtime_error("LabelIndex: failed to build perfect hash");
+        }
+
+        // Place buckets largest first, searching a seed that maps every key
+        // of the bucket to a distinct free slot
+        bool tryPlace(const std::vector<uint64_t>& hashes, size_t bucketCount, size_t slotCount) {
+            std::vector<std::vector<uint32_t>> buckets(bucketCount);
+            for (size_t p = 0; p < hashes.size(); ++p) {
+                buckets[mix(hashes[p]) % bucketCount].push_back(static_cast<uint32_t>(p));
+            }
+            std::vector<size_t> order(bucketCount);
+            std::iota(order.begin(), order.end(), size_t{ 0 });
+            std::stable_sort(order.begin(), order.end(),
+                [&](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+            seeds.assign(bucketCount, 0);
+            slots.assign(slotCount, -1);
+            std::vector<size_t> chosen;
+            for (size_t b : order) {
+                const auto& keys = buckets[b];
+                if (keys.empty()) break;
+                bool placed = false;
+                for (uint32_t seed = 0; seed < (1u << 16) && !placed; ++seed) {
+                    chosen.clear();
+                    placed = true;
+                    for (uint32_t p : keys) {
+                        const size_t s = slotHash(hashes[p], seed) % slotCount;
+                        if (slots[s] >= 0 || std::find(chosen.begin(), chosen.end(), s) != chosen.end()) {
+                            placed = false;
+                            break;
+                        }
+                        chosen.push_back(s);
+                    }
+                    if (placed) {
+                        seeds[b] = seed;
+                        for (size_t k = 0; k < keys.size(); ++k) slots[chosen[k]] = static_cast<int32_t>(keys[k]);
+                    }
+                }
+                if (!placed) return false;
+            }
+            return true;
+        }
+    };
+
+} // namespace mini::dsl
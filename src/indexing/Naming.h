@@ -15,6 +15,9 @@ Examples:
   // Constraint naming
   std::string constrName = naming::nameND("constr", i); // "constr[i]"
 
+  // Label-valued indices
+  std::string labeled = naming::nameLabels("ship", "SKU-1", depot); // "ship[SKU-1,depot]"
+
   // General string building
   std::string name = naming::make_name("prefix_", base, "_suffix");
 */
@@ -70,6 +73,29 @@ namespace mini::naming {
         }
     }
 
+    /// Name with arbitrary index values (string labels, IDs, ...): "base[a,b]".
+    /// Values without operator<< are written as '?'
+    template<typename... Parts>
+    inline std::string nameLabels(const std::string& base, const Parts&... parts) {
+        if constexpr (!DEBUG_NAMES) return "";
+        else {
+            if constexpr (sizeof...(parts) == 0) return base;
+            else {
+                std::ostringstream oss;
+                oss << base << '[';
+                size_t k = 0;
+                auto put = [&](const auto& part) {
+                    if (k++ > 0) oss << ',';
+                    if constexpr (requires { oss << part; }) oss << part;
+                    else oss << '?';
+                };
+                (put(parts), ...);
+                oss << ']';
+                return oss.str();
+            }
+        }
+    }
+
     // Macro for convenient usage
 #define MINI_MAKE_NAME(...) ::mini::naming::make_name(__VA_ARGS__)
 
@@ -0,0 +1,297 @@
+#pragma once
+/*
+Parallel.h
+Multi-threaded variants of the dsl loops.
+
+Features:
+- sum(par, f, I, J, K): outermost range split into contiguous blocks,
+  one term buffer per thread
+- Buffers merged in block order, so the expression is identical to the
+  sequential sum() whatever the thread count
+- forEach(par, f, I, J): flattened iteration space cut into chunks and
+  scheduled with work stealing (each worker drains its own chunks, then
+  steals from the others)
+- One persistent worker pool for every parallel call; it grows to the
+  largest thread count requested, so many small passes pay no thread start-up
+- Lambdas must only read shared data or write disjoint slots; keep
+  GRBModel calls (addVar, addConstr, set, ...) outside the parallel section.
+  Lazy VariableGroups must be materialized first: creating a lazy element
+  inside a parallel pass throws std::logic_error
+
+Examples:
+  // Default thread count (hardware concurrency)
+  GRBLinExpr obj = sum(par, [&](int i, int j, int k) {
+      return term(cost(i,j,k), x(i,j,k));
+  }, I, J, K);
+
+  // Explicit thread count
+  GRBLinExpr e = sum(Parallel{ 4 }, [&](int i) { return w[i] * y(i); }, I);
+
+  // Compute row data in parallel, then talk to the solver sequentially
+  std::vector<double> rhs(n * m);
+  forEach(par, [&](int i, int j) { rhs[i * m + j] = expensiveBound(i, j); }, I, J);
+  forEach([&](int i, int j) { model.addConstr(x(i,j) <= rhs[i * m + j]); }, I, J);
+*/
+
+#include <span>
+#include <array>
+#include <tuple>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+#include <iterator>
+#include <utility>
+#include <exception>
+#include <algorithm>
+#include <type_traits>
+#include "gurobi_c++.h"
+#include "Indexing.h"
+
+namespace mini::dsl {
+
+    /// Parallel execution policy (threads == 0 uses hardware concurrency,
+    /// chunk == 0 picks a chunk size from the iteration count)
+    struct Parallel {
+        unsigned threads = 0;
+        size_t chunk = 0;
+
+        unsigned count() const {
+            if (threads > 0) return threads;
+            const unsigned hw = std::thread::hardware_concurrency();
+            return hw > 0 ? hw : 1;
+        }
+    };
+
+    inline constexpr Parallel par{};
+
+    template<>
+    struct is_execution_policy<Parallel> : std::true_type {};
+
+    namespace detail {
+
+        /// Process-wide pool of worker threads. A job runs fn(w) for w in
+        /// [0, workers): worker 0 is the calling thread, the others are pool
+        /// threads created on first need and kept for later jobs. Jobs from
+        /// different threads are serialized; a job started from inside a
+        /// running job runs inline on the current thread.
+        class WorkerPool {
+            using Job = std::function<void(unsigned)>;
+
+            std::mutex submitMutex;                 ///< One job at a time
+            std::mutex stateMutex;
+            std::condition_variable wake, finished;
+            std::vector<std::jthread> threads;      ///< Thread t runs worker t + 1
+            const Job* job = nullptr;
+            unsigned jobWorkers = 0;
+            unsigned remaining = 0;                 ///< Pool workers still running the job
+            size_t generation = 0;                  ///< Incremented per job
+            bool stopping = false;
+
+        public:
+            static WorkerPool& instance() {
+                static WorkerPool pool;
+                return pool;
+            }
+
+            ~WorkerPool() {
+                {
+                    std::lock_guard lock(stateMutex);
+                    stopping = true;
+                }
+                wake.notify_all();
+            }
+
+            void run(unsigned workers, const Job& fn) {
+                if (workers <= 1 || parallelSection) {
+                    for (unsigned w = 0; w < workers; ++w) fn(w);
+                    return;
+                }
+                std::lock_guard submit(submitMutex);
+                {
+                    std::lock_guard lock(stateMutex);
+                    while (threads.size() + 1 < workers) {
+                        const unsigned id = static_cast<unsigned>(threads.size()) + 1;
+                        threads.emplace_back([this, id, seen = generation] { loop(id, seen); });
+                    }
+                    job = &fn;
+                    jobWorkers = workers;
+                    remaining = workers - 1;
+                    ++generation;
+                }
+                wake.notify_all();
+                fn(0);
+                std::unique_lock lock(stateMutex);
+                finished.wait(lock, [&] { return remaining == 0; });
+                job = nullptr;
+            }
+
+        private:
+            void loop(unsigned id, size_t seen) {
+                std::unique_lock lock(stateMutex);
+                for (;;) {
+                    wake.wait(lock, [&] { return stopping || generation != seen; });
+                    if (stopping) return;
+                    seen = generation;
+                    if (id >= jobWorkers) continue;
+                    const Job* fn = job;
+                    lock.unlock();
+                    (*fn)(id);
+                    lock.lock();
+                    if (--remaining == 0) finished.notify_one();
+                }
+            }
+        };
+
+        /// Run fn(worker) for `workers` workers on the shared pool (worker 0 on
+        /// the calling thread) and rethrow the first exception raised by any of them
+        template<typename Fn>
+        void runWorkers(unsigned workers, Fn&& fn) {
+            std::vector<std::exception_ptr> errors(workers);
+            const std::function<void(unsigned)> guarded = [&](unsigned w) {
+                const bool outer = std::exchange(parallelSection, true);
+                try { fn(w); }
+                catch (...) { errors[w] = std::current_exception(); }
+                parallelSection = outer;
+            };
+            WorkerPool::instance().run(workers, guarded);
+            for (auto& e : errors) {
+                if (e) std::rethrow_exception(e);
+            }
+        }
+
+        /// Elements of a range in iteration order (random access for splitting)
+        template<typename Range>
+        auto collect(const Range& range) {
+            using Elem = std::decay_t<decltype(*std::begin(range))>;
+            std::vector<Elem> out;
+            out.reserve(rangeSize(range));
+            for (const auto& e : range) out.push_back(e);
+            return out;
+        }
+
+        /// Call f with the elements at positions pos[0..] of each column,
+        /// expanding the elements of tuple-domain ranges into several indices
+        template<size_t D, typename Ranges, typename F, typename Cols, typename... Args>
+        void callAt(F& f, const Cols& cols, const size_t* pos, const Args&... args) {
+            if constexpr (D == std::tuple_size_v<Cols>) {
+                f(args...);
+            }
+            else {
+                const auto& e = std::get<D>(cols)[pos[D]];
+                if constexpr (!is_tuple_domain_v<std::tuple_element_t<D, Ranges>>) {
+                    callAt<D + 1, Ranges>(f, cols, pos, args..., e);
+                }
+                else {
+                    std::apply([&](const auto&... js) { callAt<D + 1, Ranges>(f, cols, pos, args..., js...); }, e);
+                }
+            }
+        }
+
+        /// Work-stealing scheduler over chunk ids [0, chunks): each worker owns
+        /// a contiguous share, claims from its front, then steals from others
+        template<typename Fn>
+        void runChunks(unsigned workers, size_t chunks, Fn&& fn) {
+            auto next = std::make_unique<std::atomic<size_t>[]>(workers);
+            std::vector<size_t> last(workers);
+            for (unsigned w = 0; w < workers; ++w) {
+                next[w].store(chunks * w / workers, std::memory_order_relaxed);
+                last[w] = chunks * (w + 1) / workers;
+            }
+            runWorkers(workers, [&](unsigned self) {
+                for (unsigned k = 0; k < workers; ++k) {
+                    const unsigned victim = (self + k) % workers;
+                    for (size_t c; (c = next[victim].fetch_add(1, std::memory_order_relaxed)) < last[victim];) {
+                        fn(c);
+                    }
+                }
+            });
+        }
+
+    } // namespace detail
+
+    /// Parallel summation: the outermost range is split across threads
+    template<typename F, typename Range, typename... Rest>
+    GRBLinExpr sum(const Parallel& policy, F&& f, const Range& outer, const Rest&... rest) {
+        const auto elems = detail::collect(outer);
+        using Block = std::span<const std::decay_t<decltype(elems[0])>>;
+        const size_t n = elems.size();
+        const unsigned workers = static_cast<unsigned>(std::min<size_t>(policy.count(), std::max<size_t>(n, 1)));
+
+        const size_t inner = (rangeSize(rest) * ... * size_t{ 1 });
+        std::vector<LinearAccumulator> parts(workers);
+        detail::runWorkers(workers, [&](unsigned w) {
+            const size_t first = n * w / workers, last = n * (w + 1) / workers;
+            const Block block(elems.data() + first, last - first);
+            parts[w].reserve(block.size() * inner);
+            if constexpr (is_tuple_domain_v<Range>) {
+                const TupleDomain<Block> domain(block);
+                SumLoop<F, TupleDomain<Block>, Rest...>::run(parts[w], f, domain, rest...);
+            }
+            else {
+                SumLoop<F, Block, Rest...>::run(parts[w], f, block, rest...);
+            }
+        });
+
+        // Deterministic merge: blocks appended in range order
+        LinearAccumulator total;
+        size_t terms = 0;
+        for (const auto& p : parts) terms += p.size();
+        total.reserve(terms);
+        for (const auto& p : parts) total.append(p);
+        return total.build();
+    }
+
+    /// Parallel iteration that exposes the chunk schedule: prepare(chunks)
+    /// runs once before the workers start, then f(chunk, idx...) runs for
+    /// every index tuple. Chunk c always covers the same contiguous slice of
+    /// the flattened space, so per-chunk results can be merged in order.
+    template<typename Prepare, typename F, typename... Ranges>
+    void forEachChunk(const Parallel& policy, Prepare&& prepare, F&& f, const Ranges&... ranges) {
+        constexpr size_t R = sizeof...(Ranges);
+        static_assert(R > 0, "forEach(par, ...) needs at least one range");
+
+        const auto cols = std::make_tuple(detail::collect(ranges)...);
+        const auto extents = std::apply([](const auto&... c) { return std::array<size_t, R>{ c.size()... }; }, cols);
+        size_t total = 1;
+        for (size_t n : extents) total *= n;
+        if (total == 0) {
+            prepare(size_t{ 0 });
+            return;
+        }
+
+        const unsigned workers = static_cast<unsigned>(std::min<size_t>(policy.count(), total));
+        const size_t chunk = policy.chunk > 0 ? policy.chunk : std::max<size_t>(1, total / (size_t{ workers } * 16));
+        const size_t chunks = (total + chunk - 1) / chunk;
+        prepare(chunks);
+
+        detail::runChunks(workers, chunks, [&](size_t c) {
+            const size_t first = c * chunk, last = std::min(total, first + chunk);
+            auto body = [&](const auto&... idx) { f(c, idx...); };
+
+            // Unravel the first offset, then step the multi-index like an odometer
+            std::array<size_t, R> pos{};
+            for (size_t d = R, off = first; d-- > 0;) {
+                pos[d] = off % extents[d];
+                off /= extents[d];
+            }
+            for (size_t off = first; off < last; ++off) {
+                detail::callAt<0, std::tuple<Ranges...>>(body, cols, pos.data());
+                for (size_t d = R; d-- > 0;) {
+                    if (++pos[d] < extents[d]) break;
+                    pos[d] = 0;
+                }
+            }
+        });
+    }
+
+    /// Parallel iteration over the flattened product of the ranges
+    template<typename F, typename... Ranges>
+    void forEach(const Parallel& policy, F&& f, const Ranges&... ranges) {
+        forEachChunk(policy, [](size_t) {}, [&](size_t, const auto&... idx) { f(idx...); }, ranges...);
+    }
+
+} // namespace mini::dsl
@@ -16,9 +16,13 @@ Examples:
 
   // Variadic iteration (new preferred way)
   FORALL([&](int i, int j) { ... }, I, J);
+
+  // Parallel iteration (no GRBModel calls inside the body)
+  FORALL(par, [&](int i, int j) { ... }, I, J);
 */
 
 #include "Indexing.h"
+#include "Parallel.h"
 
 // ============================================================================
 // ZERO-OVERHEAD LOOP MACROS (For maximum performance)
@@ -25,6 +25,14 @@ Examples:
           forall2(i, 10, j, 20) {
               addLe(model, vars.var(Vars::X, i, j), vars.var(Vars::Y, i), "link_constraint");
           }
+          // Queued rows: added in one call, singletons may become bounds
+          forall2(i, 10, j, 20) {
+              addLe(rows, vars.var(Vars::X, i, j), capacity[i], "cap");
+          }
+          // Separated on demand from the solver callback
+          auto& X = vars.get(Vars::X);
+          addLazyFamily(std::span<const GRBVar>(X.data(), X.size()),
+              [&](std::span<const double> x, ConstraintBatch& out) { separateConflicts(x, out); }, "conflict");
       }
 
       void setObjective() override {
@@ -38,13 +46,22 @@ Examples:
   auto result = model.solve({.timeLimitSec = 300, .mipGap = 0.01});
   if (result.success) {
       std::cout << "Objective: " << result.objective << "\n";
+      std::cout << "Rows turned into bounds: " << result.build.boundsTightened << "\n";
+      for (const auto& [family, f] : result.build.families)   // rows queued via addConstr(rows, f, "name", ...)
+          std::cout << family << ": " << f.rowsAdded << " rows, " << f.duplicatesDropped << " duplicates\n";
   }
 */
 
+#include <span>
 #include <chrono>
+#include <utility>
+#include <string>
+#include <iostream>
 #include <format>
 #include "gurobi_c++.h"
 #include "../core/VariableTable.h"
+#include "../core/ConstraintBatch.h"
+#include "Separation.h"
 
 namespace mini {
 
@@ -56,6 +73,8 @@ namespace mini {
         bool verbose = true;         ///< Enable solver output
         int solutionLimit = 0;       ///< 0 = no limit
         double nodeLimit = 0;        ///< 0 = no limit
+        bool singletonsToBounds = false;  ///< Queued one-variable rows become LB/UB updates
+        bool dropRedundantRows = false;   ///< Queued duplicate / dominated parallel rows are dropped
 
         RunOptions() = default;
 
@@ -72,6 +91,8 @@ namespace mini {
         GRBEnv env;                          ///< Gurobi environment
         GRBModel model;                      ///< Gurobi model
         VariableTable<EnumT, MAX> vars;      ///< Variable storage
+        ConstraintBatch rows;                ///< Queued rows, added in buildModel()
+        SeparationCallback separation;       ///< Lazy / user-cut families, installed by solve()
 
     public:
         ModelBuilder() : env(), model(env) {
@@ -97,6 +118,16 @@ namespace mini {
         /// Optional model configuration (presolve, parameters, etc.)
         virtual void configureModel() {}
 
+        /// Register a lazy constraint family (call from addConstraints())
+        void addLazyFamily(std::span<const GRBVar> watched, Separator separate, const std::string& name = "") {
+            separation.addLazyFamily(watched, std::move(separate), name);
+        }
+
+        /// Register a user-cut family (call from addConstraints())
+        void addCutFamily(std::span<const GRBVar> watched, Separator separate, const std::string& name = "") {
+            separation.addCutFamily(watched, std::move(separate), name);
+        }
+
         // ============================================================================
         // SOLVE ORCHESTRATION
         // ============================================================================
@@ -109,6 +140,9 @@ namespace mini {
             double runtimeSec = 0.0;         ///< Total solve time
             int nodeCount = 0;               ///< Nodes explored
             double gap = 0.0;                ///< Final optimality gap
+            BuildStats build;                ///< Rows added / bounds tightened from `rows`
+            size_t lazyAdded = 0;            ///< Rows added by lazy families
+            size_t cutsAdded = 0;            ///< Rows added by user-cut families
             GRBModel* model = nullptr;       ///< Pointer to solved model
             std::string errorMsg;            ///< Error description if failed
 
@@ -123,8 +157,9 @@ namespace mini {
             }
         };
 
-        /// Build the complete model
+        /// Build the complete model (queued rows are added in one call)
         GRBModel& buildModel() {
+            rows.flush(model);
             configureModel();
             model.update();
             return model;
@@ -138,10 +173,12 @@ namespace mini {
 
             try {
                 // Build the model
+                rows.setOptions({ .singletonsToBounds = opts.singletonsToBounds, .dropRedundant = opts.dropRedundantRows });
                 createVariables();
                 addConstraints();
                 setObjective();
                 buildModel();
+                result.build = rows.stats();
 
                 // Apply solver options
                 if (opts.timeLimitSec > 0)
@@ -157,13 +194,22 @@ namespace mini {
 
                 model.set(GRB_IntParam_OutputFlag, opts.verbose ? 1 : 0);
 
-                // Solve
+                // Separation callback for lazy / user-cut families
+                if (!separation.empty()) {
+                    separation.configure(model);
+                    model.setCallback(&separation);
+                }
+
+                // Solve (a separator that threw aborted it; report its exception)
                 model.optimize();
+                separation.rethrowFailure();
 
                 // Capture results
                 auto endTime = std::chrono::high_resolution_clock::now();
                 result.runtimeSec = std::chrono::duration<double>(endTime - startTime).count();
                 result.status = model.get(GRB_IntAttr_Status);
+                result.lazyAdded = separation.added(SeparationCallback::Kind::Lazy);
+                result.cutsAdded = separation.added(SeparationCallback::Kind::UserCut);
                 result.nodeCount = static_cast<int>(model.get(GRB_DoubleAttr_NodeCount));
 
                 if (result.hasSolution()) {
@@ -31,6 +31,8 @@ namespace mini {
         double nodeLimit = 0;        ///< Maximum nodes to explore (0 = no limit)
         int presolve = -1;           ///< Presolve level (-1 = solver default)
         int method = -1;             ///< Solution method (-1 = automatic)
+        bool singletonsToBounds = false;  ///< Queued one-variable rows become LB/UB updates
+        bool dropRedundantRows = false;   ///< Queued duplicate / dominated parallel rows are dropped
 
         RunOptions() = default;
 
@@ -0,0 +1,161 @@
+#pragma once
+/*
+Separation.h
+Lazy constraint and user-cut families added on demand from a solver callback.
+
+Features:
+- A family is a set of watched variables plus a separation routine
+- The routine gets the watched values as one flat array (incumbent for lazy
+  families, node relaxation for user cuts) and returns violated rows in a
+  ConstraintBatch
+- One getSolution / getNodeRel call per family and callback
+- Per-family counters of separation rounds and rows added
+- An exception thrown by a routine never crosses the solver: the callback
+  stores it, aborts the solve, and rethrowFailure() raises it afterwards
+
+Examples:
+  // Subtour elimination: nothing is built upfront
+  SeparationCallback sep;
+  sep.addLazyFamily(std::span<const GRBVar>(X.data(), X.size()),
+      [&](std::span<const double> x, ConstraintBatch& rows) {
+          for (const std::vector<int>& S : findSubtours(x, n)) {
+              GRBLinExpr inside = sum([&](int a, int b) { return X(S[a], S[b]); }, indices(S.size()), indices(S.size()));
+              rows.add(inside, GRB_LESS_EQUAL, S.size() - 1.0);
+          }
+      }, "subtour");
+
+  sep.configure(model);                 // LazyConstraints / PreCrush
+  model.setCallback(&sep);
+  model.optimize();
+  sep.rethrowFailure();                 // a separator's exception, if it threw
+
+  // Inside ModelBuilder: register in addConstraints(), solve() installs the callback
+  addLazyFamily(std::span<const GRBVar>(X.data(), X.size()), separateSubtours, "subtour");
+*/
+
+#include <span>
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <exception>
+#include <functional>
+#include "gurobi_c++.h"
+#include "../core/ConstraintBatch.h"
+
+namespace mini {
+
+    /// Separation routine: watched values in, violated rows out
+    using Separator = std::function<void(std::span<const double>, ConstraintBatch&)>;
+
+    class SeparationCallback : public GRBCallback {
+    public:
+        enum class Kind { Lazy, UserCut };
+
+        /// One registered family and its counters
+        struct Family {
+            Kind kind;
+            std::string name;
+            std::vector<GRBVar> vars;     ///< Watched variables (order of the value array)
+            Separator separate;
+            size_t rounds = 0;            ///< Times the routine was called
+            size_t added = 0;             ///< Rows handed to the solver
+        };
+
+    private:
+        std::vector<Family> families;
+        ConstraintBatch rows;             ///< Reused output buffer
+        std::vector<double> values;       ///< Reused input buffer
+        std::exception_ptr failure;       ///< First exception thrown inside the callback
+
+    public:
+        /// Lazy family: separated at every new incumbent (GRB_CB_MIPSOL); rows are
+        /// required for feasibility. Needs GRB_IntParam_LazyConstraints = 1.
+        void addLazyFamily(std::span<const GRBVar> vars, Separator separate, const std::string& name = "") {
+            families.push_back(Family{ Kind::Lazy, name, { vars.begin(), vars.end() }, std::move(separate) });
+        }
+
+        /// User-cut family: separated at nodes with an optimal relaxation
+        /// (GRB_CB_MIPNODE); rows only tighten the LP. Needs GRB_IntParam_PreCrush = 1.
+        void addCutFamily(std::span<const GRBVar> vars, Separator separate, const std::string& name = "") {
+            families.push_back(Family{ Kind::UserCut, name, { vars.begin(), vars.end() }, std::move(separate) });
+        }
+
+        bool empty() const { return families.empty(); }
+        bool hasLazy() const { return has(Kind::Lazy); }
+        bool hasUserCuts() const { return has(Kind::UserCut); }
+
+        const std::vector<Family>& registered() const { return families; }
+
+        /// Rows added across all families of a kind
+        size_t added(Kind kind) const {
+            size_t total = 0;
+            for (const auto& f : families) {
+                if (f.kind == kind) total += f.added;
+            }
+            return total;
+        }
+
+        /// Set the parameters the registered kinds need (call before optimize())
+        void configure(GRBModel& model) const {
+            if (hasLazy()) model.set(GRB_IntParam_LazyConstraints, 1);
+            if (hasUserCuts()) model.set(GRB_IntParam_PreCrush, 1);
+        }
+
+        /// Rethrow (once) the exception that aborted the last optimize(), if any
+        void rethrowFailure() {
+            if (failure) std::rethrow_exception(std::exchange(failure, nullptr));
+        }
+
+    protected:
+        /// Exceptions must not unwind through the solver: the first one is
+        /// stored and the solve aborted (later calls do nothing until rethrown)
+        void callback() override {
+            if (failure) return;
+            try {
+                if (where == GRB_CB_MIPSOL) {
+                    run(Kind::Lazy);
+                }
+                else if (where == GRB_CB_MIPNODE && hasUserCuts() && getIntInfo(GRB_CB_MIPNODE_STATUS) == GRB_OPTIMAL) {
+                    run(Kind::UserCut);
+                }
+            }
+            catch (...) {
+                failure = std::current_exception();
+                abort();
+            }
+        }
+
+    private:
+        bool has(Kind kind) const {
+            for (const auto& f : families) {
+                if (f.kind == kind) return true;
+            }
+            return false;
+        }
+
+        void run(Kind kind) {
+            for (auto& f : families) {
+                if (f.kind != kind || f.vars.empty()) continue;
+
+                const int n = static_cast<int>(f.vars.size());
+                std::unique_ptr<double[]> raw(kind == Kind::Lazy
+                    ? getSolution(f.vars.data(), n) : getNodeRel(f.vars.data(), n));
+                values.assign(raw.get(), raw.get() + n);
+
+                rows.clear();
+                f.separate(values, rows);
+                ++f.rounds;
+                f.added += rows.rows();
+
+                rows.forEachRow([&](std::span<const GRBVar> vs, std::span<const double> cs, char sense, double rhs) {
+                    GRBLinExpr e;
+                    if (!vs.empty()) e.addTerms(cs.data(), vs.data(), static_cast<int>(vs.size()));
+                    if (kind == Kind::Lazy) addLazy(e, sense, rhs);
+                    else addCut(e, sense, rhs);
+                    });
+            }
+        }
+    };
+
+} // namespace mini